@@ -48,6 +48,10 @@ int main(int argc, char** argv) {
   highs.passOptions(loaded_options);
   //  highs.writeOptions("Options.md");
 
+  // Possibly serve as a worker of distributed MIP solves
+  if (options.mip_worker_socket != "")
+    return (int)highs.runMipWorker(options.mip_worker_socket);
+
   // Load the model from model_file
   HighsStatus read_status = highs.readModel(model_file);
   reportModelStatsOrError(log_options, read_status, highs.getModel());
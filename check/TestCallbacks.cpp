@@ -253,3 +253,65 @@ TEST_CASE("highs-callback-mip-data", "[highs-callback]") {
   highs.readModel(filename);
   highs.run();
 }
+
+static void userTreeSizeCallback(const int callback_type, const char* message,
+                                 const HighsCallbackDataOut* data_out,
+                                 HighsCallbackDataIn* data_in,
+                                 void* user_callback_data) {
+  assert(callback_type == kCallbackMipLogging);
+  if (dev_run)
+    printf("userTreeSizeCallback: Node count = %" PRId64
+           "; Tree weight = %6.4f; Remaining nodes = %11.4g (%11.4g, "
+           "%11.4g, %11.4g); Remaining time = %11.4g\n",
+           data_out->mip_node_count, data_out->mip_tree_weight,
+           data_out->mip_remaining_nodes,
+           data_out->mip_remaining_nodes_backtrack,
+           data_out->mip_remaining_nodes_tree_weight,
+           data_out->mip_remaining_nodes_gap, data_out->mip_remaining_time);
+  REQUIRE(data_out->mip_tree_weight >= 0);
+  REQUIRE(data_out->mip_tree_weight <= 1);
+  REQUIRE(data_out->mip_remaining_nodes_backtrack >= 0);
+  REQUIRE(data_out->mip_remaining_nodes_tree_weight >= 0);
+  REQUIRE(data_out->mip_remaining_nodes_gap >= 0);
+  REQUIRE(data_out->mip_remaining_time >= 0);
+  // the combined estimate is one of the finite estimates
+  if (data_out->mip_remaining_nodes < kHighsInf)
+    REQUIRE((data_out->mip_remaining_nodes ==
+                 data_out->mip_remaining_nodes_backtrack ||
+             data_out->mip_remaining_nodes ==
+                 data_out->mip_remaining_nodes_tree_weight ||
+             data_out->mip_remaining_nodes ==
+                 data_out->mip_remaining_nodes_gap));
+  ++*(HighsInt*)user_callback_data;
+}
+
+TEST_CASE("highs-callback-mip-tree-size", "[highs-callback]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  // The MIP logging callback is only called when there is output
+  highs.setOptionValue("output_flag", true);
+  highs.setOptionValue("log_to_console", dev_run);
+  highs.setOptionValue("mip_min_logging_interval", 0);
+  HighsInt num_callbacks = 0;
+  highs.setCallback(userTreeSizeCallback, (void*)(&num_callbacks));
+  highs.startCallback(kCallbackMipLogging);
+  highs.readModel(filename);
+
+  // Stopping at a node limit leaves an estimate of the remaining search
+  highs.setOptionValue("mip_max_nodes", 100);
+  highs.run();
+  REQUIRE(num_callbacks > 0);
+  const HighsInfo& info = highs.getInfo();
+  REQUIRE(highs.getModelStatus() != HighsModelStatus::kOptimal);
+  REQUIRE(info.mip_tree_weight < 1);
+  REQUIRE(info.mip_remaining_nodes > 0);
+  REQUIRE(info.mip_remaining_nodes < kHighsInf);
+
+  // When the search is complete, no nodes remain
+  highs.setOptionValue("mip_max_nodes", kHighsIInf);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(info.mip_tree_weight == 1);
+  REQUIRE(info.mip_remaining_nodes == 0);
+  REQUIRE(info.mip_remaining_time == 0);
+}
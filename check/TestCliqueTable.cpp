@@ -0,0 +1,89 @@
+#include <algorithm>
+
+#include "HCheckConfig.h"
+#include "catch.hpp"
+#include "mip/HighsCliqueTable.h"
+#include "util/HighsRandom.h"
+
+using CliqueVar = HighsCliqueTable::CliqueVar;
+
+// Checks that partitionNeighbourhood moves exactly the vertices that have a
+// common clique with v to the front and counts one query per vertex
+static void checkNeighbourhood(HighsCliqueTable& cliquetable, CliqueVar v,
+                               std::vector<CliqueVar> q) {
+  std::vector<uint8_t> expected(q.size());
+  HighsInt numExpected = 0;
+  for (size_t i = 0; i < q.size(); ++i) {
+    expected[i] = cliquetable.haveCommonClique(v, q[i]);
+    numExpected += expected[i];
+  }
+
+  std::vector<CliqueVar> partitioned = q;
+  std::vector<HighsInt> neighbourhoodInds;
+  int64_t numQueries = 0;
+  HighsInt numNeighbours = cliquetable.partitionNeighbourhood(
+      neighbourhoodInds, numQueries, v, partitioned.data(), q.size());
+  REQUIRE(numNeighbours == numExpected);
+  if (cliquetable.numCliques(v) != 0) REQUIRE(numQueries == (int64_t)q.size());
+
+  // the neighbours keep their relative order
+  HighsInt k = 0;
+  for (size_t i = 0; i < q.size(); ++i) {
+    if (!expected[i]) continue;
+    REQUIRE(partitioned[k] == q[i]);
+    ++k;
+  }
+}
+
+TEST_CASE("CliqueTable-neighbourhood", "[highs_clique_table]") {
+  const HighsInt numCol = 3000;
+  HighsCliqueTable cliquetable(numCol);
+  HighsRandom random(11);
+
+  // a dense block of the conflict graph, as given by an assignment constraint
+  std::vector<CliqueVar> clique;
+  for (HighsInt col = 0; col < 2000; ++col) clique.emplace_back(col, 1);
+  cliquetable.doAddClique(clique.data(), clique.size(), true);
+
+  std::vector<HighsInt> cliqueIds;
+  for (HighsInt i = 0; i < 500; ++i) {
+    HighsInt len = 2 + random.integer(8);
+    clique.clear();
+    HighsInt col = random.integer(numCol - 10 * len);
+    for (HighsInt j = 0; j < len; ++j) {
+      col += 1 + random.integer(10);
+      clique.emplace_back(col, random.integer(2));
+    }
+    cliquetable.doAddClique(clique.data(), clique.size());
+  }
+  // remove some of the cliques so that their slots are reused
+  for (HighsInt cliqueid = 1; cliqueid < 500; cliqueid += 7)
+    cliquetable.removeClique(cliqueid);
+  for (HighsInt i = 0; i < 50; ++i) {
+    clique.clear();
+    HighsInt col = random.integer(numCol - 20);
+    clique.emplace_back(col, random.integer(2));
+    clique.emplace_back(col + 1 + random.integer(19), random.integer(2));
+    cliquetable.doAddClique(clique.data(), clique.size());
+  }
+
+  std::vector<CliqueVar> allVertices;
+  for (HighsInt col = 0; col < numCol; ++col) {
+    allVertices.emplace_back(col, 0);
+    allVertices.emplace_back(col, 1);
+  }
+
+  for (HighsInt i = 0; i < 40; ++i) {
+    CliqueVar v(random.integer(numCol), random.integer(2));
+    // many queries, as for the dense block
+    checkNeighbourhood(cliquetable, v, allVertices);
+    // few queries
+    std::vector<CliqueVar> q;
+    for (HighsInt j = 0; j < 10; ++j)
+      q.push_back(allVertices[random.integer(allVertices.size())]);
+    checkNeighbourhood(cliquetable, v, q);
+  }
+
+  checkNeighbourhood(cliquetable, CliqueVar(5, 1), allVertices);
+  checkNeighbourhood(cliquetable, CliqueVar(5, 0), allVertices);
+}
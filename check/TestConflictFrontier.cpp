@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <set>
+
+#include "HCheckConfig.h"
+#include "catch.hpp"
+#include "mip/HighsDomain.h"
+#include "util/HighsRandom.h"
+
+const bool dev_run = false;
+
+using LocalDomChg = HighsDomain::ConflictSet::LocalDomChg;
+using Frontier = HighsDomain::ConflictSet::Frontier;
+
+// Frontier with the std::set based implementation that the flat frontier
+// replaces, used as reference
+struct SetFrontier {
+  std::set<LocalDomChg> entries;
+
+  void reset(HighsInt) { entries.clear(); }
+
+  std::pair<LocalDomChg*, bool> insert(const LocalDomChg& domchg) {
+    auto insertResult = entries.insert(domchg);
+    return std::make_pair(const_cast<LocalDomChg*>(&*insertResult.first),
+                          insertResult.second);
+  }
+
+  LocalDomChg* find(HighsInt pos) {
+    auto it = entries.find(LocalDomChg{pos, HighsDomainChange()});
+    return it == entries.end() ? nullptr : const_cast<LocalDomChg*>(&*it);
+  }
+
+  void erase(HighsInt pos) {
+    entries.erase(LocalDomChg{pos, HighsDomainChange()});
+  }
+
+  void sort() {}
+
+  std::set<LocalDomChg>::const_iterator begin() const {
+    return entries.begin();
+  }
+  std::set<LocalDomChg>::const_iterator end() const { return entries.end(); }
+
+  std::set<LocalDomChg>::const_iterator lower_bound(HighsInt pos) const {
+    return entries.lower_bound(LocalDomChg{pos, HighsDomainChange()});
+  }
+};
+
+// Replays the access pattern of resolving a conflict: the domain change with
+// the largest position is repeatedly replaced by domain changes at smaller
+// positions, of which some are already contained and tighten the bound of the
+// contained entry. The frontier is iterated after every few resolution steps.
+// Returns a checksum over all iterations, or -1 if the frontier is not
+// consistent.
+template <typename FrontierType>
+double resolveTrace(FrontierType& frontier, HighsInt stackSize,
+                    HighsInt numAnalyses, HighsInt numSteps) {
+  HighsRandom random(7);
+  std::vector<HighsInt> queue;
+  double checksum = 0;
+  for (HighsInt analysis = 0; analysis < numAnalyses; ++analysis) {
+    frontier.reset(stackSize);
+    queue.clear();
+    for (HighsInt i = 0; i < 20; ++i) {
+      HighsInt pos = stackSize / 2 + random.integer(stackSize / 2);
+      auto insertResult = frontier.insert(LocalDomChg{
+          pos, HighsDomainChange{double(pos), pos, HighsBoundType::kLower}});
+      if (insertResult.second) queue.push_back(pos);
+    }
+    std::make_heap(queue.begin(), queue.end());
+
+    for (HighsInt step = 0; step < numSteps && !queue.empty(); ++step) {
+      std::pop_heap(queue.begin(), queue.end());
+      HighsInt pos = queue.back();
+      queue.pop_back();
+      if (frontier.find(pos) == nullptr) return -1;
+      frontier.erase(pos);
+
+      HighsInt numReasons = 1 + random.integer(4);
+      for (HighsInt i = 0; i < numReasons && pos > 0; ++i) {
+        HighsInt reasonPos = random.integer(pos);
+        double boundval = random.fraction() * reasonPos;
+        auto insertResult = frontier.insert(LocalDomChg{
+            reasonPos, HighsDomainChange{boundval, reasonPos,
+                                         HighsBoundType::kLower}});
+        if (insertResult.second) {
+          queue.push_back(reasonPos);
+          std::push_heap(queue.begin(), queue.end());
+        } else {
+          insertResult.first->domchg.boundval =
+              std::max(insertResult.first->domchg.boundval, boundval);
+        }
+      }
+
+      if (step % 8 == 7) {
+        frontier.sort();
+        HighsInt lastPos = -1;
+        for (auto it = frontier.lower_bound(pos / 2); it != frontier.end();
+             ++it) {
+          if (it->pos <= lastPos) return -1;
+          lastPos = it->pos;
+          checksum += it->pos + it->domchg.boundval;
+        }
+      }
+    }
+  }
+
+  return checksum;
+}
+
+TEST_CASE("ConflictFrontier", "[highs_conflict_frontier]") {
+  const HighsInt stackSize = 1000;
+  Frontier frontier;
+  SetFrontier reference;
+  const double checksum = resolveTrace(frontier, stackSize, 20, 200);
+  REQUIRE(checksum > 0);
+  REQUIRE(checksum == resolveTrace(reference, stackSize, 20, 200));
+
+  frontier.reset(stackSize);
+  reference.reset(stackSize);
+  HighsRandom random(3);
+  for (HighsInt i = 0; i < 2000; ++i) {
+    HighsInt pos = random.integer(stackSize);
+    if (random.fraction() < 0.3) {
+      if (reference.find(pos) == nullptr) continue;
+      frontier.erase(pos);
+      reference.erase(pos);
+      REQUIRE(frontier.find(pos) == nullptr);
+    } else {
+      LocalDomChg domchg{
+          pos, HighsDomainChange{double(i), pos, HighsBoundType::kUpper}};
+      auto insertResult = frontier.insert(domchg);
+      REQUIRE(insertResult.second == reference.insert(domchg).second);
+      REQUIRE(insertResult.first->pos == pos);
+    }
+    REQUIRE(frontier.size() == (HighsInt)reference.entries.size());
+  }
+
+  frontier.sort();
+  auto it = frontier.begin();
+  for (const LocalDomChg& domchg : reference) {
+    REQUIRE(it != frontier.end());
+    REQUIRE(it->pos == domchg.pos);
+    REQUIRE(it->domchg.boundval == domchg.domchg.boundval);
+    ++it;
+  }
+  REQUIRE(it == frontier.end());
+  REQUIRE(frontier.lower_bound(stackSize / 2) - frontier.begin() ==
+          std::distance(reference.begin(), reference.lower_bound(stackSize / 2)));
+}
+
+TEST_CASE("ConflictFrontierBenchmark", "[highs_conflict_frontier]") {
+  const HighsInt stackSize = 10000;
+  const HighsInt numAnalyses = 200;
+  const HighsInt numSteps = 500;
+
+  Frontier frontier;
+  auto beg = std::chrono::high_resolution_clock::now();
+  double flatChecksum = resolveTrace(frontier, stackSize, numAnalyses, numSteps);
+  auto end = std::chrono::high_resolution_clock::now();
+  double flatTime =
+      std::chrono::duration_cast<std::chrono::microseconds>(end - beg).count() /
+      1e3;
+
+  SetFrontier reference;
+  beg = std::chrono::high_resolution_clock::now();
+  double setChecksum = resolveTrace(reference, stackSize, numAnalyses, numSteps);
+  end = std::chrono::high_resolution_clock::now();
+  double setTime =
+      std::chrono::duration_cast<std::chrono::microseconds>(end - beg).count() /
+      1e3;
+
+  if (dev_run)
+    std::cout << "conflict frontier, flat arrays: " << flatTime
+              << "ms, std::set: " << setTime << "ms" << std::endl;
+
+  REQUIRE(flatChecksum > 0);
+  REQUIRE(flatChecksum == setChecksum);
+}
@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <vector>
+
+#include "HCheckConfig.h"
+#include "catch.hpp"
+#include "mip/HighsDynamicRowMatrix.h"
+#include "util/HighsRandom.h"
+
+const bool dev_run = false;
+
+// Row of the reference model, which records the time at which its columns
+// were linked
+struct ReferenceRow {
+  std::vector<HighsInt> index;
+  std::vector<double> value;
+  bool deleted = false;
+  bool linked = false;
+  HighsInt linkTime = -1;
+};
+
+// The column entries of the linked rows in the order of decreasing link time
+static std::vector<std::pair<HighsInt, double>> referenceColumn(
+    const std::vector<ReferenceRow>& rows, HighsInt col, bool positive) {
+  std::vector<std::pair<HighsInt, std::pair<HighsInt, double>>> entries;
+  for (HighsInt row = 0; row != (HighsInt)rows.size(); ++row) {
+    if (rows[row].deleted || !rows[row].linked) continue;
+    for (size_t i = 0; i != rows[row].index.size(); ++i) {
+      if (rows[row].index[i] != col) continue;
+      if ((rows[row].value[i] > 0) != positive) continue;
+      entries.emplace_back(-rows[row].linkTime,
+                           std::make_pair(row, rows[row].value[i]));
+    }
+  }
+  std::sort(entries.begin(), entries.end());
+  std::vector<std::pair<HighsInt, double>> column;
+  for (const auto& entry : entries) column.push_back(entry.second);
+  return column;
+}
+
+static bool checkMatrix(const HighsDynamicRowMatrix& matrix,
+                        const std::vector<ReferenceRow>& rows,
+                        HighsInt numCol) {
+  if (matrix.getNumRows() != (HighsInt)rows.size()) return false;
+  for (HighsInt row = 0; row != (HighsInt)rows.size(); ++row) {
+    if (rows[row].deleted) {
+      if (matrix.getRowStart(row) != -1) return false;
+      continue;
+    }
+    if (matrix.columnsLinked(row) != rows[row].linked) return false;
+    HighsInt start = matrix.getRowStart(row);
+    HighsInt len = matrix.getRowEnd(row) - start;
+    if (len != (HighsInt)rows[row].index.size()) return false;
+    if (!std::equal(rows[row].index.begin(), rows[row].index.end(),
+                    matrix.getARindex() + start))
+      return false;
+    if (!std::equal(rows[row].value.begin(), rows[row].value.end(),
+                    matrix.getARvalue() + start))
+      return false;
+  }
+
+  for (HighsInt col = 0; col != numCol; ++col) {
+    std::vector<std::pair<HighsInt, double>> column;
+    matrix.forEachPositiveColumnEntry(col, [&](HighsInt row, double val) {
+      column.emplace_back(row, val);
+      return true;
+    });
+    if (column != referenceColumn(rows, col, true)) return false;
+
+    column.clear();
+    matrix.forEachNegativeColumnEntry(col, [&](HighsInt row, double val) {
+      column.emplace_back(row, val);
+      return true;
+    });
+    if (column != referenceColumn(rows, col, false)) return false;
+  }
+
+  return true;
+}
+
+TEST_CASE("DynamicRowMatrix-column-access", "[highs_dynamic_row_matrix]") {
+  const HighsInt numCol = 40;
+  HighsDynamicRowMatrix matrix(numCol);
+  std::vector<ReferenceRow> rows;
+  std::vector<HighsInt> deletedRows;
+  HighsRandom random(3);
+  HighsInt linkTime = 0;
+  HighsInt numCompactions = 0;
+
+  for (HighsInt round = 0; round != 50; ++round) {
+    // add rows, then unlink and remove some of them in random order
+    for (HighsInt k = 0; k != 20; ++k) {
+      ReferenceRow row;
+      HighsInt len = random.integer(1, 10);
+      for (HighsInt col = 0; col != numCol; ++col) {
+        if (random.integer(numCol) >= len) continue;
+        row.index.push_back(col);
+        row.value.push_back(random.fraction() - 0.5);
+      }
+      row.linked = random.fraction() < 0.8;
+      if (row.linked) row.linkTime = linkTime++;
+      HighsInt rowindex =
+          matrix.addRow(row.index.data(), row.value.data(), row.index.size(),
+                        row.linked);
+
+      HighsInt expectedIndex = rows.size();
+      if (!deletedRows.empty()) {
+        expectedIndex = deletedRows.back();
+        deletedRows.pop_back();
+      }
+      REQUIRE(rowindex == expectedIndex);
+      if (rowindex == (HighsInt)rows.size()) rows.emplace_back();
+      rows[rowindex] = row;
+    }
+
+    for (HighsInt k = 0; k != 15; ++k) {
+      HighsInt row = random.integer(rows.size());
+      if (rows[row].deleted) continue;
+      if (random.fraction() < 0.3) {
+        matrix.unlinkColumns(row);
+        rows[row].linked = false;
+      } else {
+        matrix.removeRow(row);
+        rows[row].deleted = true;
+        deletedRows.push_back(row);
+      }
+    }
+    REQUIRE(checkMatrix(matrix, rows, numCol));
+
+    std::size_t capacity = matrix.nonzeroCapacity();
+    matrix.compact();
+    if (matrix.nonzeroCapacity() < capacity) ++numCompactions;
+    REQUIRE(checkMatrix(matrix, rows, numCol));
+  }
+
+  // removing most of the rows leaves the storage fragmented
+  for (HighsInt row = 0; row != (HighsInt)rows.size(); ++row) {
+    if (rows[row].deleted || random.fraction() < 0.2) continue;
+    matrix.removeRow(row);
+    rows[row].deleted = true;
+  }
+  std::size_t capacity = matrix.nonzeroCapacity();
+  matrix.compact();
+  if (matrix.nonzeroCapacity() < capacity) ++numCompactions;
+  if (dev_run) printf("%d compactions\n", int(numCompactions));
+  REQUIRE(matrix.nonzeroCapacity() < capacity);
+  REQUIRE(checkMatrix(matrix, rows, numCol));
+
+  // the iteration over a column stops when the function object returns false
+  HighsInt numCalls = 0;
+  for (HighsInt col = 0; col != numCol; ++col) {
+    numCalls = 0;
+    matrix.forEachPositiveColumnEntry(col, [&](HighsInt, double) {
+      ++numCalls;
+      return false;
+    });
+    REQUIRE(numCalls == std::min(HighsInt{1},
+                                 (HighsInt)referenceColumn(rows, col, true)
+                                     .size()));
+  }
+}
@@ -2,6 +2,7 @@
 
 #include "HCheckConfig.h"
 #include "catch.hpp"
+#include "mip/HighsGF2Solve.h"
 #include "mip/HighsGFkSolve.h"
 #include "util/HighsRandom.h"
 
@@ -66,6 +67,52 @@ void testGFkSolve(const std::vector<HighsInt>& Avalue,
       });
 }
 
+void testGF2Solve(const std::vector<HighsInt>& Avalue,
+                  const std::vector<HighsInt>& Aindex,
+                  const std::vector<HighsInt>& Astart, HighsInt numRow) {
+  REQUIRE(HighsGF2Solve::fitsDense(numRow, Astart.size() - 1));
+
+  HighsGF2Solve GF2Solve;
+  GF2Solve.fromCSC(Avalue, Aindex, Astart, numRow);
+  GF2Solve.setRhs(numRow - 1, 1);
+
+  HighsInt numCol = Astart.size() - 1;
+  for (HighsInt i = 0; i != numCol; ++i)
+    for (HighsInt j = Astart[i]; j != Astart[i + 1]; ++j)
+      REQUIRE(GF2Solve.getEntry(Aindex[j], i) == (Avalue[j] % 2 != 0));
+
+  // the same system has a solution over GF(2) with the generic solver, so the
+  // bit-packed solver must find solutions too
+  HighsInt numSolutions = 0;
+  GF2Solve.solve([&](const std::vector<HighsGF2Solve::SolutionEntry>& solution,
+                     int rhsIndex) {
+    REQUIRE(rhsIndex == 0);
+    ++numSolutions;
+
+    std::vector<unsigned int> solSums(numRow);
+    for (const auto& solentry : solution) {
+      REQUIRE(solentry.weight == 1);
+      for (HighsInt j = Astart[solentry.index];
+           j != Astart[solentry.index + 1]; ++j)
+        solSums[Aindex[j]] ^= (Avalue[j] % 2 != 0);
+    }
+
+    for (HighsInt i = 0; i < numRow - 1; ++i) REQUIRE(solSums[i] == 0);
+
+    REQUIRE(solSums[numRow - 1] == 1);
+  });
+
+  HighsInt numGFkSolutions = 0;
+  HighsGFkSolve GFkSolve;
+  GFkSolve.fromCSC<2>(Avalue, Aindex, Astart, numRow);
+  GFkSolve.setRhs<2>(numRow - 1, 1);
+  GFkSolve.solve<2>(
+      [&](const std::vector<HighsGFkSolve::SolutionEntry>&, int) {
+        ++numGFkSolutions;
+      });
+  REQUIRE((numSolutions == 0) == (numGFkSolutions == 0));
+}
+
 TEST_CASE("GFkSolve", "[mip]") {
   std::vector<HighsInt> Avalue;
   std::vector<HighsInt> Aindex;
@@ -99,4 +146,5 @@ TEST_CASE("GFkSolve", "[mip]") {
   testGFkSolve<5>(Avalue, Aindex, Astart, numRow);
   testGFkSolve<7>(Avalue, Aindex, Astart, numRow);
   testGFkSolve<11>(Avalue, Aindex, Astart, numRow);
+  testGF2Solve(Avalue, Aindex, Astart, numRow);
 }
@@ -123,3 +123,44 @@ TEST_CASE("HotStart-rgn", "[highs_test_hot_start]") {
   // Cannot use the continuous solution as a hot start now
   REQUIRE(highs.setHotStart(hot_start) == HighsStatus::kError);
 }
+
+TEST_CASE("HotStart-resolveLp", "[highs_test_hot_start]") {
+  std::string filename;
+  filename = std::string(HIGHS_DIR) + "/check/instances/avgas.mps";
+
+  Highs highs;
+  if (!dev_run) highs.setOptionValue("output_flag", false);
+  highs.readModel(filename);
+  // Without a simplex basis resolveLp() solves the LP with run()
+  REQUIRE(highs.resolveLp() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+
+  Highs check;
+  check.setOptionValue("output_flag", false);
+  check.readModel(filename);
+
+  const HighsLp& lp = highs.getLp();
+  const HighsInt num_col = lp.num_col_;
+  // Tighten the column bounds one by one and add a row, checking
+  // each re-solve against a solve from scratch
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    const double upper = 0.5 * (lp.col_lower_[iCol] + lp.col_upper_[iCol]);
+    highs.changeColBounds(iCol, lp.col_lower_[iCol], upper);
+    check.changeColBounds(iCol, lp.col_lower_[iCol], upper);
+    if (iCol == num_col / 2) {
+      std::vector<HighsInt> index = {0, 1};
+      std::vector<double> value = {1, 1};
+      highs.addRow(-inf, 0.5, 2, index.data(), value.data());
+      check.addRow(-inf, 0.5, 2, index.data(), value.data());
+    }
+    REQUIRE(highs.resolveLp() == HighsStatus::kOk);
+    check.clearSolver();
+    check.run();
+    REQUIRE(highs.getModelStatus() == check.getModelStatus());
+    REQUIRE(highs.getBasis().valid);
+    if (check.getModelStatus() == HighsModelStatus::kOptimal)
+      REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                        check.getInfo().objective_function_value) <
+              double_equal_tolerance);
+  }
+}
@@ -434,3 +434,31 @@ TEST_CASE("dual-objective-upper-bound", "[highs_lp_solver]") {
   if (dev_run) printf("\nOptimal objective value error = %g\n", error);
   REQUIRE(error < 1e-10);
 }
+
+TEST_CASE("simplex-work-limit", "[highs_lp_solver]") {
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  const HighsInfo& info = highs.getInfo();
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/e226.mps";
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  highs.setOptionValue("solver", kSimplexString);
+  highs.setOptionValue("presolve", kHighsOffString);
+
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const int64_t work_count = info.work_count;
+  REQUIRE(work_count > 0);
+
+  // The work count of the same solve is the same
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(info.work_count == work_count);
+
+  // Stop the solve after half of the work
+  highs.setOptionValue("work_limit", 0.5 * work_count);
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kWarning);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kWorkLimit);
+  REQUIRE(info.work_count >= 0.5 * work_count);
+  REQUIRE(info.work_count < work_count);
+}
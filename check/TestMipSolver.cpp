@@ -1,7 +1,10 @@
+#include <thread>
+
 #include "HCheckConfig.h"
 #include "Highs.h"
 #include "SpecialLps.h"
 #include "catch.hpp"
+#include "mip/HighsMipDistributed.h"
 
 const bool dev_run = false;
 const double double_equal_tolerance = 1e-5;
@@ -570,6 +573,456 @@ TEST_CASE("MIP-objective-target", "[highs_test_mip_solver]") {
   REQUIRE(highs.getInfo().objective_function_value > egout_optimal_objective);
 }
 
+TEST_CASE("MIP-parallel-tree-search", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double serial_objective = highs.getInfo().objective_function_value;
+
+  // Subtrees are searched in rounds with a fixed node limit, so repeated runs
+  // must explore the same tree
+  Highs::resetGlobalScheduler(true);
+  highs.setOptionValue("threads", 4);
+  highs.setOptionValue("mip_parallel_tree_search", true);
+  highs.setOptionValue("mip_subtree_node_limit", 50);
+  int64_t node_count = -1;
+  double objective = kHighsInf;
+  for (HighsInt k = 0; k < 2; k++) {
+    highs.clearSolver();
+    highs.run();
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                      serial_objective) <= 1e-4 * std::fabs(serial_objective));
+    if (k == 0) {
+      node_count = highs.getInfo().mip_node_count;
+      objective = highs.getInfo().objective_function_value;
+    } else {
+      REQUIRE(highs.getInfo().mip_node_count == node_count);
+      REQUIRE(highs.getInfo().objective_function_value == objective);
+    }
+  }
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-root-racing", "[highs_test_mip_solver]") {
+  const double lseu_optimal_objective = 1120;
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/lseu.mps";
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("threads", 4);
+  highs.setOptionValue("mip_root_racers", 3);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    lseu_optimal_objective) < double_equal_tolerance);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-parallel-strong-branching", "[highs_test_mip_solver]") {
+  const double flugpl_optimal_objective = 1201500;
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/flugpl.mps";
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("threads", 4);
+  highs.setOptionValue("mip_parallel_strong_branching", true);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double objective = highs.getInfo().objective_function_value;
+  const int64_t node_count = highs.getInfo().mip_node_count;
+  REQUIRE(std::fabs(objective - flugpl_optimal_objective) <
+          double_equal_tolerance);
+
+  // The candidate evaluations are merged in a fixed order, so repeated runs
+  // search the same tree
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(highs.getInfo().objective_function_value == objective);
+  REQUIRE(highs.getInfo().mip_node_count == node_count);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-node-spill", "[highs_test_mip_solver]") {
+  // With no memory for open nodes every node that is put into the node queue
+  // is moved to the spill file and read back when it is selected
+  const double bell5_optimal_objective = 8966406.49152;
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("mip_node_memory_limit", 0);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    bell5_optimal_objective) /
+              bell5_optimal_objective <
+          1e-8);
+}
+
+TEST_CASE("MIP-parallel-separation", "[highs_test_mip_solver]") {
+  const double dcmulti_optimal_objective = 188182;
+  std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/dcmulti.mps";
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("threads", 4);
+  highs.setOptionValue("mip_parallel_separation", true);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double objective = highs.getInfo().objective_function_value;
+  const int64_t node_count = highs.getInfo().mip_node_count;
+  REQUIRE(std::fabs(objective - dcmulti_optimal_objective) <
+          double_equal_tolerance);
+
+  // The cuts of the separators are merged in a fixed order, so repeated runs
+  // give the same result
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getInfo().objective_function_value == objective);
+  REQUIRE(highs.getInfo().mip_node_count == node_count);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-checkpoint", "[highs_test_mip_solver]") {
+  const double bell5_optimal_objective = 8966406.49152;
+  const std::string checkpoint_file = "MIP-checkpoint.ckpt";
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("mip_rel_gap", 0.0);
+  highs.setOptionValue("mip_max_nodes", 200);
+  highs.setOptionValue("mip_checkpoint_file", checkpoint_file);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kSolutionLimit);
+  const int64_t interrupted_node_count = highs.getInfo().mip_node_count;
+
+  // The search continues with the node count of the interrupted search, so it
+  // stops right away when the node limit is small
+  Highs resumed;
+  resumed.setOptionValue("output_flag", dev_run);
+  resumed.setOptionValue("mip_rel_gap", 0.0);
+  resumed.setOptionValue("mip_max_nodes", 1);
+  resumed.setOptionValue("mip_resume_file", checkpoint_file);
+  resumed.readModel(filename);
+  resumed.run();
+  REQUIRE(resumed.getModelStatus() == HighsModelStatus::kSolutionLimit);
+  REQUIRE(resumed.getInfo().mip_node_count >= interrupted_node_count);
+
+  resumed.setOptionValue("mip_max_nodes", kHighsIInf);
+  resumed.clearSolver();
+  resumed.run();
+  REQUIRE(resumed.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(resumed.getInfo().objective_function_value -
+                    bell5_optimal_objective) /
+              bell5_optimal_objective <
+          1e-8);
+
+  // A checkpoint of a different model is ignored
+  const double flugpl_optimal_objective = 1201500;
+  resumed.readModel(std::string(HIGHS_DIR) + "/check/instances/flugpl.mps");
+  resumed.run();
+  REQUIRE(resumed.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(resumed.getInfo().objective_function_value -
+                    flugpl_optimal_objective) < double_equal_tolerance);
+
+  std::remove(checkpoint_file.c_str());
+}
+
+TEST_CASE("MIP-warm-start", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/p0548.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(filename);
+  REQUIRE(highs.setMipWarmStart(HighsMipWarmStart()) == HighsStatus::kError);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double optimal_objective = highs.getInfo().objective_function_value;
+  HighsMipWarmStart warm_start = highs.getMipWarmStart();
+  REQUIRE(warm_start.valid);
+  REQUIRE(!warm_start.solutions.empty());
+  REQUIRE(warm_start.solutions[0].objective == optimal_objective);
+
+  // Re-solving the same model uses all of the warm start
+  Highs warm;
+  warm.setOptionValue("output_flag", dev_run);
+  warm.readModel(filename);
+  REQUIRE(warm.setMipWarmStart(warm_start) == HighsStatus::kOk);
+  warm.run();
+  REQUIRE(warm.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(warm.getInfo().objective_function_value -
+                    optimal_objective) < double_equal_tolerance);
+
+  // The cuts and conflicts are only valid with the previous incumbent
+  HighsMipWarmStart no_solutions = warm_start;
+  no_solutions.solutions.clear();
+  REQUIRE(warm.setMipWarmStart(no_solutions) == HighsStatus::kOk);
+  warm.clearSolver();
+  warm.run();
+  REQUIRE(warm.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(warm.getInfo().objective_function_value -
+                    optimal_objective) < double_equal_tolerance);
+
+  // A model with changed costs only uses the solutions and pseudocosts
+  const HighsLp& lp = highs.getLp();
+  HighsInt col = 0;
+  while (lp.integrality_[col] != HighsVarType::kInteger) col++;
+  const double cost = lp.col_cost_[col] + 10;
+  highs.changeColCost(col, cost);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  warm.changeColCost(col, cost);
+  REQUIRE(warm.setMipWarmStart(warm_start) == HighsStatus::kOk);
+  warm.run();
+  REQUIRE(warm.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(warm.getInfo().objective_function_value -
+                    highs.getInfo().objective_function_value) <
+          double_equal_tolerance);
+}
+
+TEST_CASE("MIP-distributed", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double serial_objective = highs.getInfo().objective_function_value;
+
+  // The workers run on threads of this process and are connected to the
+  // supervisor by socket pairs
+  const HighsInt num_worker = 2;
+  std::vector<std::shared_ptr<HighsMipTransport>> connections;
+  std::vector<std::thread> workers;
+  std::vector<HighsStatus> worker_status(num_worker, HighsStatus::kError);
+  for (HighsInt k = 0; k < num_worker; k++) {
+    std::unique_ptr<HighsSocketTransport> supervisor_end;
+    std::unique_ptr<HighsSocketTransport> worker_end;
+    // Sockets are not available on all platforms
+    if (!HighsSocketTransport::createPair(supervisor_end, worker_end)) return;
+    connections.push_back(std::move(supervisor_end));
+    std::shared_ptr<HighsMipTransport> transport = std::move(worker_end);
+    workers.emplace_back([transport, k, &worker_status]() {
+      Highs worker;
+      worker.setOptionValue("output_flag", dev_run);
+      worker_status[k] = worker.runMipWorker(*transport);
+    });
+  }
+  // A worker whose connection is closed is dropped in the first round
+  std::unique_ptr<HighsSocketTransport> lost_end;
+  std::unique_ptr<HighsSocketTransport> closed_end;
+  REQUIRE(HighsSocketTransport::createPair(lost_end, closed_end));
+  closed_end.reset();
+  connections.push_back(std::move(lost_end));
+  REQUIRE(highs.setMipWorkers(connections) == HighsStatus::kOk);
+  connections.clear();
+
+  // Each worker receives one subtree with a fixed node limit per round, so
+  // repeated runs must explore the same tree
+  highs.setOptionValue("mip_subtree_node_limit", 50);
+  int64_t node_count = -1;
+  for (HighsInt k = 0; k < 2; k++) {
+    highs.clearSolver();
+    highs.run();
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                      serial_objective) <= 1e-4 * std::fabs(serial_objective));
+    if (k == 0)
+      node_count = highs.getInfo().mip_node_count;
+    else
+      REQUIRE(highs.getInfo().mip_node_count == node_count);
+  }
+
+  // Closing the connections stops the workers
+  REQUIRE(highs.setMipWorkers(connections) == HighsStatus::kOk);
+  for (std::thread& worker : workers) worker.join();
+  for (HighsStatus status : worker_status) REQUIRE(status == HighsStatus::kOk);
+}
+
+TEST_CASE("MIP-parallel-propagation", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/p0548.mps";
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("threads", 4);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const int64_t node_count = highs.getInfo().mip_node_count;
+  const double dual_bound = highs.getInfo().mip_dual_bound;
+  const double objective = highs.getInfo().objective_function_value;
+
+  // The bound changes of the rows are computed in parallel but applied in the
+  // order of the rows, so the search must be the same
+  highs.setOptionValue("mip_min_propagation_nnz_for_parallelism", 0);
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(highs.getInfo().mip_node_count == node_count);
+  REQUIRE(highs.getInfo().mip_dual_bound == dual_bound);
+  REQUIRE(highs.getInfo().objective_function_value == objective);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-lns-portfolio", "[highs_test_mip_solver]") {
+  const double bell5_optimal_objective = 8966406.49152;
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("threads", 2);
+  // allow enough heuristic effort for all neighbourhoods to be searched
+  highs.setOptionValue("mip_heuristic_effort", 1.0);
+  highs.setOptionValue("mip_lns_portfolio", true);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    bell5_optimal_objective) /
+              bell5_optimal_objective <
+          1e-8);
+
+  // The concurrent sub-MIPs are finished at the next search of a
+  // neighbourhood, so repeated runs give the same result
+  highs.setOptionValue("mip_concurrent_lns", true);
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double objective = highs.getInfo().objective_function_value;
+  const int64_t node_count = highs.getInfo().mip_node_count;
+  REQUIRE(std::fabs(objective - bell5_optimal_objective) /
+              bell5_optimal_objective <
+          1e-8);
+
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getInfo().objective_function_value == objective);
+  REQUIRE(highs.getInfo().mip_node_count == node_count);
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-work-limit", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const int64_t work_count = highs.getInfo().work_count;
+  REQUIRE(work_count > 0);
+
+  // Stopping after a fixed amount of work is reproducible, unlike a time
+  // limit
+  highs.setOptionValue("work_limit", 0.5 * work_count);
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kWorkLimit);
+  const int64_t limited_work_count = highs.getInfo().work_count;
+  const int64_t limited_node_count = highs.getInfo().mip_node_count;
+  const double limited_dual_bound = highs.getInfo().mip_dual_bound;
+  REQUIRE(limited_work_count >= 0.5 * work_count);
+  REQUIRE(limited_work_count < work_count);
+
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kWorkLimit);
+  REQUIRE(highs.getInfo().work_count == limited_work_count);
+  REQUIRE(highs.getInfo().mip_node_count == limited_node_count);
+  REQUIRE(highs.getInfo().mip_dual_bound == limited_dual_bound);
+}
+
+TEST_CASE("MIP-solution-pool", "[highs_test_mip_solver]") {
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(filename);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double optimal_objective = highs.getInfo().objective_function_value;
+  const std::vector<double> optimal_solution = highs.getSolution().col_value;
+
+  // The pool holds distinct solutions in the order of decreasing quality,
+  // the first of which is the optimal solution
+  std::vector<HighsObjectiveSolution> pool = highs.getMipSolutionPool();
+  REQUIRE(pool.size() > 1);
+  REQUIRE(pool.size() <= 10);
+  REQUIRE(std::fabs(pool[0].objective - optimal_objective) <
+          double_equal_tolerance);
+  for (size_t i = 1; i < pool.size(); i++) {
+    REQUIRE(pool[i].objective >= pool[i - 1].objective);
+    REQUIRE(pool[i].col_value != pool[i - 1].col_value);
+  }
+
+  // The values of the integer columns of the optimal solution are completed
+  // to the optimal solution before the root node is evaluated, which does
+  // not find it without them
+  const HighsLp& lp = highs.getLp();
+  std::vector<HighsInt> index;
+  std::vector<double> value;
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+    if (lp.integrality_[iCol] != HighsVarType::kInteger) continue;
+    index.push_back(iCol);
+    value.push_back(optimal_solution[iCol]);
+  }
+  REQUIRE(index.size() < optimal_solution.size());
+  highs.setOptionValue("mip_max_nodes", 1);
+  highs.setOptionValue("mip_heuristic_effort", 0);
+  highs.clearSolver();
+  highs.run();
+  const double root_objective = highs.getInfo().objective_function_value;
+  REQUIRE(root_objective > optimal_objective + double_equal_tolerance);
+
+  // A start with an invalid column index is rejected
+  std::vector<HighsInt> invalid_index = {0, lp.num_col_};
+  std::vector<double> invalid_value = {0, 0};
+  REQUIRE(highs.addMipStart(2, invalid_index.data(), invalid_value.data()) ==
+          HighsStatus::kError);
+
+  // Both starts are completed, the second from half of the values
+  REQUIRE(highs.addMipStart(index.size(), index.data(), value.data()) ==
+          HighsStatus::kOk);
+  REQUIRE(highs.addMipStart(index.size() / 2, index.data(), value.data()) ==
+          HighsStatus::kOk);
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) < double_equal_tolerance);
+  REQUIRE(highs.getMipSolutionPool().size() >= 1);
+
+  // The starts are only used for one solve
+  highs.clearSolver();
+  highs.run();
+  REQUIRE(highs.getInfo().objective_function_value == root_objective);
+}
+
+TEST_CASE("MIP-subtree-restarts", "[highs_test_mip_solver]") {
+  // Subtrees whose nodes fix most integer columns are solved as presolved
+  // sub-MIPs, which must not change the optimal objective
+  const double bell5_optimal_objective = 8966406.49152;
+  std::string filename = std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(filename);
+  for (double fixing_rate : {0.3, 0.5, 0.7}) {
+    highs.setOptionValue("mip_subtree_restart_fixing_rate", fixing_rate);
+    highs.clearSolver();
+    highs.run();
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                      bell5_optimal_objective) <
+            1e-6 * bell5_optimal_objective);
+  }
+}
+
 bool objectiveOk(const double optimal_objective,
                  const double require_optimal_objective,
                  const bool dev_run = false) {
@@ -79,6 +79,137 @@ TEST_CASE("presolve", "[highs_test_presolve]") {
   REQUIRE(presolved_model.isEmpty());
 }
 
+TEST_CASE("postsolve-many-fixed-cols", "[highs_test_presolve]") {
+  // Enough fixed columns for postsolve to undo them as a parallel batch
+  const HighsInt num_fixed_col = 5000;
+  HighsLp lp;
+  lp.num_col_ = num_fixed_col + 1;
+  lp.num_row_ = 1;
+  double optimal_objective = 0;
+  for (HighsInt iCol = 0; iCol < num_fixed_col; iCol++) {
+    const double value = iCol % 3;
+    lp.col_cost_.push_back(1 + iCol % 5);
+    lp.col_lower_.push_back(value);
+    lp.col_upper_.push_back(value);
+    optimal_objective += lp.col_cost_[iCol] * value;
+  }
+  lp.col_cost_.push_back(-1);
+  lp.col_lower_.push_back(0);
+  lp.col_upper_.push_back(10);
+  optimal_objective -= 10;
+  lp.row_lower_.push_back(-kHighsInf);
+  lp.row_upper_.push_back(2 * num_fixed_col);
+  lp.a_matrix_.format_ = MatrixFormat::kColwise;
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+    lp.a_matrix_.start_.push_back(iCol);
+    lp.a_matrix_.index_.push_back(0);
+    lp.a_matrix_.value_.push_back(1);
+  }
+  lp.a_matrix_.start_.push_back(lp.num_col_);
+
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) < 1e-6);
+  const HighsSolution& solution = highs.getSolution();
+  const HighsBasis& basis = highs.getBasis();
+  REQUIRE(basis.valid);
+  for (HighsInt iCol = 0; iCol < num_fixed_col; iCol++) {
+    REQUIRE(solution.col_value[iCol] == iCol % 3);
+    REQUIRE(std::fabs(solution.col_dual[iCol] - lp.col_cost_[iCol]) < 1e-9);
+    REQUIRE(basis.col_status[iCol] != HighsBasisStatus::kBasic);
+  }
+}
+
+TEST_CASE("presolve-orbital-aggregation", "[highs_test_presolve]") {
+  // Transportation LP with identical commodities that share the arc
+  // capacities, so that the commodities can be permuted arbitrarily
+  const HighsInt num_commodity = 4;
+  const HighsInt num_supply = 2;
+  const HighsInt num_demand = 3;
+  const std::vector<double> supply = {30, 25};
+  const std::vector<double> demand = {12, 15, 10};
+  const std::vector<double> cost = {4, 6, 9, 5, 3, 8};
+  const std::vector<double> capacity = {40, 30, 25, 30, 40, 30};
+  const HighsInt num_arc = num_supply * num_demand;
+  auto arcVar = [&](HighsInt k, HighsInt s, HighsInt d) {
+    return k * num_arc + s * num_demand + d;
+  };
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  for (HighsInt k = 0; k < num_commodity; k++)
+    for (HighsInt a = 0; a < num_arc; a++)
+      highs.addCol(cost[a], 0, kHighsInf, 0, nullptr, nullptr);
+  std::vector<HighsInt> index;
+  std::vector<double> value;
+  for (HighsInt k = 0; k < num_commodity; k++) {
+    for (HighsInt s = 0; s < num_supply; s++) {
+      index.clear();
+      for (HighsInt d = 0; d < num_demand; d++)
+        index.push_back(arcVar(k, s, d));
+      value.assign(index.size(), 1);
+      highs.addRow(-kHighsInf, supply[s], index.size(), index.data(),
+                   value.data());
+    }
+    for (HighsInt d = 0; d < num_demand; d++) {
+      index.clear();
+      for (HighsInt s = 0; s < num_supply; s++)
+        index.push_back(arcVar(k, s, d));
+      value.assign(index.size(), 1);
+      highs.addRow(demand[d], kHighsInf, index.size(), index.data(),
+                   value.data());
+    }
+  }
+  for (HighsInt a = 0; a < num_arc; a++) {
+    index.clear();
+    for (HighsInt k = 0; k < num_commodity; k++)
+      index.push_back(k * num_arc + a);
+    value.assign(index.size(), 1);
+    highs.addRow(-kHighsInf, 1.5 * capacity[a], index.size(), index.data(),
+                 value.data());
+  }
+  const HighsLp lp = highs.getLp();
+
+  highs.setOptionValue("presolve", kHighsOffString);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double optimal_objective = highs.getInfo().objective_function_value;
+
+  // Orbital aggregation is only used if presolve need not yield a basis
+  highs.clearSolver();
+  highs.setOptionValue("presolve", kHighsOnString);
+  highs.setOptionValue("lp_presolve_requires_basis_postsolve", false);
+  REQUIRE(highs.presolve() == HighsStatus::kOk);
+  REQUIRE(highs.getPresolvedLp().num_col_ == num_arc);
+
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const HighsInfo& info = highs.getInfo();
+  REQUIRE(std::fabs(info.objective_function_value - optimal_objective) <
+          1e-6);
+  REQUIRE(info.num_primal_infeasibilities == 0);
+  REQUIRE(info.num_dual_infeasibilities == 0);
+  REQUIRE(!highs.getBasis().valid);
+
+  // The lifted solution is symmetric and satisfies complementary slackness
+  const HighsSolution& solution = highs.getSolution();
+  for (HighsInt k = 1; k < num_commodity; k++)
+    for (HighsInt a = 0; a < num_arc; a++) {
+      REQUIRE(solution.col_value[k * num_arc + a] == solution.col_value[a]);
+      REQUIRE(solution.col_dual[k * num_arc + a] == solution.col_dual[a]);
+    }
+  double dual_objective = 0;
+  for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++) {
+    const double row_dual = solution.row_dual[iRow];
+    dual_objective +=
+        row_dual * (row_dual > 0 ? lp.row_lower_[iRow] : lp.row_upper_[iRow]);
+  }
+  REQUIRE(std::fabs(dual_objective - optimal_objective) < 1e-6);
+}
+
 void presolveSolvePostsolve(const std::string& model_file,
                             const bool solve_relaxation) {
   Highs highs0;
@@ -1,9 +1,11 @@
+#include <algorithm>
 #include <cstdio>
 
 #include "HCheckConfig.h"
 #include "Highs.h"
 #include "catch.hpp"
 #include "io/FilereaderLp.h"
+#include "util/HighsRandom.h"
 
 const bool dev_run = false;
 const double inf = kHighsInf;
@@ -600,3 +602,98 @@ TEST_CASE("test-semi-definite2", "[qpsolver]") {
   REQUIRE(fabs(solution.col_value[0] + 1) < double_equal_tolerance);
   REQUIRE(fabs(solution.col_value[1] - 2) < double_equal_tolerance);
 }
+
+static void ipmSolveAndCompare(Highs& highs) {
+  // Solve with the active set solver for reference
+  highs.setOptionValue("solver", kHighsChooseString);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const HighsModelStatus required_model_status = highs.getModelStatus();
+  const double reference_objective_function_value =
+      highs.getInfo().objective_function_value;
+  const double objective_tolerance =
+      double_equal_tolerance *
+      std::max(1.0, fabs(reference_objective_function_value));
+
+  highs.setOptionValue("solver", kIpmString);
+  double ipm_objective_function_value = kHighsInf;
+  for (const std::string& crossover : {kHighsOffString, kHighsOnString}) {
+    highs.setOptionValue("run_crossover", crossover);
+    highs.clearSolver();
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == required_model_status);
+    if (required_model_status != HighsModelStatus::kOptimal) continue;
+    const HighsInfo& info = highs.getInfo();
+    if (dev_run)
+      printf("IPM with crossover %s: objective = %g (active set %g); %d IPM "
+             "iterations\n",
+             crossover.c_str(), info.objective_function_value,
+             reference_objective_function_value,
+             int(info.ipm_iteration_count));
+    REQUIRE(info.ipm_iteration_count > 0);
+    // The active set solver may stop short of the optimum, but the
+    // interior point solver should never be worse, and crossover
+    // should not change the objective
+    REQUIRE(info.objective_function_value <
+            reference_objective_function_value + objective_tolerance);
+    if (crossover == kHighsOnString)
+      REQUIRE(fabs(info.objective_function_value -
+                   ipm_objective_function_value) < objective_tolerance);
+    ipm_objective_function_value = info.objective_function_value;
+    REQUIRE(info.max_primal_infeasibility < 1e-6);
+    REQUIRE(info.max_dual_infeasibility < 1e-6);
+    // Only crossover yields a basis
+    REQUIRE(highs.getBasis().valid == (crossover == kHighsOnString));
+  }
+  highs.setOptionValue("solver", kHighsChooseString);
+  highs.setOptionValue("run_crossover", kHighsOnString);
+}
+
+TEST_CASE("qp-ipm", "[qpsolver]") {
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  for (std::string model : {"qptestnw.lp", "qjh.mps", "qjh_uncon.mps",
+                            "qpinfeasible.lp", "qpunbounded.lp"}) {
+    std::string filename = std::string(HIGHS_DIR) + "/check/instances/" + model;
+    REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+    ipmSolveAndCompare(highs);
+  }
+
+  // Long-only portfolio with a factor model of the covariance: minimize
+  // x^TQx/2 - mu^Tx subject to the budget constraint and position limits
+  const HighsInt num_asset = 60;
+  const HighsInt num_factor = 3;
+  HighsRandom random(11);
+  std::vector<double> factor(num_asset * num_factor);
+  for (double& value : factor) value = random.fraction() - 0.5;
+
+  HighsLp lp;
+  lp.num_col_ = num_asset;
+  lp.num_row_ = 1;
+  lp.col_lower_.assign(num_asset, 0.0);
+  lp.col_upper_.assign(num_asset, 0.1);
+  for (HighsInt iCol = 0; iCol < num_asset; iCol++)
+    lp.col_cost_.push_back(-0.1 * random.fraction());
+  lp.row_lower_ = {1.0};
+  lp.row_upper_ = {1.0};
+  lp.a_matrix_.format_ = MatrixFormat::kRowwise;
+  lp.a_matrix_.start_ = {0, num_asset};
+  for (HighsInt iCol = 0; iCol < num_asset; iCol++) {
+    lp.a_matrix_.index_.push_back(iCol);
+    lp.a_matrix_.value_.push_back(1.0);
+  }
+  HighsHessian hessian;
+  hessian.dim_ = num_asset;
+  for (HighsInt iCol = 0; iCol < num_asset; iCol++) {
+    for (HighsInt iRow = iCol; iRow < num_asset; iRow++) {
+      double value = iRow == iCol ? 0.01 + 0.05 * random.fraction() : 0.0;
+      for (HighsInt k = 0; k < num_factor; k++)
+        value += factor[iRow * num_factor + k] * factor[iCol * num_factor + k];
+      hessian.index_.push_back(iRow);
+      hessian.value_.push_back(value);
+    }
+    hessian.start_.push_back(hessian.index_.size());
+  }
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  REQUIRE(highs.passHessian(hessian) == HighsStatus::kOk);
+  ipmSolveAndCompare(highs);
+}
@@ -578,7 +578,8 @@ PYBIND11_MODULE(highspy, m) {
       .value("kIterationLimit", HighsModelStatus::kIterationLimit)
       .value("kUnknown", HighsModelStatus::kUnknown)
       .value("kSolutionLimit", HighsModelStatus::kSolutionLimit)
-      .value("kInterrupt", HighsModelStatus::kInterrupt);
+      .value("kInterrupt", HighsModelStatus::kInterrupt)
+      .value("kWorkLimit", HighsModelStatus::kWorkLimit);
   py::enum_<HighsPresolveStatus>(m, "HighsPresolveStatus")
       .value("kNotPresolved", HighsPresolveStatus::kNotPresolved)
       .value("kNotReduced", HighsPresolveStatus::kNotReduced)
@@ -678,6 +679,15 @@ PYBIND11_MODULE(highspy, m) {
                      &HighsInfo::objective_function_value)
       .def_readwrite("mip_dual_bound", &HighsInfo::mip_dual_bound)
       .def_readwrite("mip_gap", &HighsInfo::mip_gap)
+      .def_readwrite("mip_tree_weight", &HighsInfo::mip_tree_weight)
+      .def_readwrite("mip_remaining_nodes", &HighsInfo::mip_remaining_nodes)
+      .def_readwrite("mip_remaining_nodes_backtrack",
+                     &HighsInfo::mip_remaining_nodes_backtrack)
+      .def_readwrite("mip_remaining_nodes_tree_weight",
+                     &HighsInfo::mip_remaining_nodes_tree_weight)
+      .def_readwrite("mip_remaining_nodes_gap",
+                     &HighsInfo::mip_remaining_nodes_gap)
+      .def_readwrite("mip_remaining_time", &HighsInfo::mip_remaining_time)
       .def_readwrite("max_integrality_violation",
                      &HighsInfo::max_integrality_violation)
       .def_readwrite("num_primal_infeasibilities",
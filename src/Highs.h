@@ -39,6 +39,8 @@ HighsInt highsVersionPatch();
 const char* highsGithash();
 const char* highsCompilationDate();
 
+class HighsMipTransport;
+
 /**
  * @brief Class to set parameters and run HiGHS
  */
@@ -436,6 +438,61 @@ class Highs {
     return saved_objective_and_solution_;
   }
 
+  /**
+   * @brief Return a const reference to the best distinct feasible
+   * solutions found by the most recent MIP solve, in the order of
+   * decreasing quality
+   */
+  const std::vector<HighsObjectiveSolution>& getMipSolutionPool() const {
+    return mip_solution_pool_;
+  }
+
+  /**
+   * @brief Return a const reference to the state learned by the most
+   * recent MIP solve, for warm starting the solve of a related model
+   */
+  const HighsMipWarmStart& getMipWarmStart() const {
+    return saved_mip_warm_start_;
+  }
+
+  /**
+   * @brief Warm start the next MIP solve with the state learned by the
+   * solve of a related model with the same columns
+   */
+  HighsStatus setMipWarmStart(const HighsMipWarmStart& mip_warm_start);
+
+  /**
+   * @brief Add values of some of the columns for the next MIP solve,
+   * which completes them to a feasible solution by solving a sub-MIP
+   * over the other columns
+   */
+  HighsStatus addMipStart(const HighsInt num_entries, const HighsInt* index,
+                          const double* value);
+
+  /**
+   * @brief Clear the MIP starts added for the next MIP solve
+   */
+  HighsStatus clearMipStarts();
+
+  /**
+   * @brief Distribute the branch-and-bound search of subsequent MIP
+   * solves to the workers at the other end of the given connections
+   */
+  HighsStatus setMipWorkers(
+      const std::vector<std::shared_ptr<HighsMipTransport>>& workers);
+
+  /**
+   * @brief Serve as a worker of a distributed MIP solve, searching the
+   * subtrees sent by the supervisor until it closes the connection
+   */
+  HighsStatus runMipWorker(HighsMipTransport& transport);
+
+  /**
+   * @brief Serve as a worker of distributed MIP solves for each
+   * supervisor that connects to the Unix socket at the given path
+   */
+  HighsStatus runMipWorker(const std::string& socket_path);
+
   /**
    * @brief Return a const reference to the internal ICrash info instance
    */
@@ -1097,6 +1154,14 @@ class Highs {
    */
   HighsStatus setHotStart(const HotStart& hot_start);
 
+  /**
+   * @brief Re-solve an LP after changes to its bounds and rows,
+   * continuing from the retained simplex basis without the model
+   * checks of run(). Falls back to run() if there is no simplex basis
+   * for the LP. Advanced method: for HiGHS MIP solver
+   */
+  HighsStatus resolveLp();
+
   /**
    * @brief Freeze the current internal HighsBasis instance and
    * standard NLA, returning a value to be used to recover this basis
@@ -1277,6 +1342,11 @@ class Highs {
   HighsRanging ranging_;
 
   std::vector<HighsObjectiveSolution> saved_objective_and_solution_;
+  HighsMipWarmStart saved_mip_warm_start_;
+  HighsMipWarmStart mip_warm_start_;
+  std::vector<HighsMipStart> mip_starts_;
+  std::vector<HighsObjectiveSolution> mip_solution_pool_;
+  std::vector<std::shared_ptr<HighsMipTransport>> mip_workers_;
 
   HighsPresolveStatus model_presolve_status_ =
       HighsPresolveStatus::kNotPresolved;
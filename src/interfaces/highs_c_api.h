@@ -79,6 +79,7 @@ const HighsInt kHighsModelStatusIterationLimit = 14;
 const HighsInt kHighsModelStatusUnknown = 15;
 const HighsInt kHighsModelStatusSolutionLimit = 16;
 const HighsInt kHighsModelStatusInterrupt = 17;
+const HighsInt kHighsModelStatusWorkLimit = 18;
 
 const HighsInt kHighsBasisStatusLower = 0;
 const HighsInt kHighsBasisStatusBasic = 1;
@@ -52,7 +52,8 @@ public enum HighsModelStatus
     kIterationLimit,
     kUnknown,
     kSolutionLimit,
-    kInterrupt
+    kInterrupt,
+    kWorkLimit
 }
 
 public enum HighsIntegrality
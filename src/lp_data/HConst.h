@@ -202,8 +202,9 @@ enum class HighsModelStatus {
   kUnknown,
   kSolutionLimit,
   kInterrupt,
+  kWorkLimit,
   kMin = kNotset,
-  kMax = kInterrupt
+  kMax = kWorkLimit
 };
 
 enum HighsCallbackType : int {
@@ -249,7 +250,8 @@ enum PresolveRuleType : int {
   kPresolveRuleDependentFreeCols,
   kPresolveRuleAggregator,
   kPresolveRuleParallelRowsAndCols,
-  kPresolveRuleMax = kPresolveRuleParallelRowsAndCols,
+  kPresolveRuleOrbitalAggregation,
+  kPresolveRuleMax = kPresolveRuleOrbitalAggregation,
   kPresolveRuleLastAllowOff = kPresolveRuleMax,
   kPresolveRuleCount,
 };
@@ -14,11 +14,15 @@
 #ifndef LP_DATA_HSTRUCT_H_
 #define LP_DATA_HSTRUCT_H_
 
+#include <cstdint>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
 #include "lp_data/HConst.h"
 
+struct HighsPseudocostInitialization;
+
 struct HighsIterationCounts {
   HighsInt simplex = 0;
   HighsInt ipm = 0;
@@ -43,6 +47,38 @@ struct HighsObjectiveSolution {
   void clear();
 };
 
+// Values of some of the columns of the original model, which the MIP solver
+// completes to a feasible solution by solving a sub-MIP over the others
+struct HighsMipStart {
+  std::vector<HighsInt> index;
+  std::vector<double> value;
+};
+
+// Learned state of a MIP solve that can be used to warm start the solve of a
+// related model with the same columns. All data refers to the original model.
+// Cuts and conflicts are only used for a model with the same hash, while the
+// pseudocosts and solutions are used for any model with the same number of
+// columns.
+struct HighsMipWarmStart {
+  bool valid = false;
+  uint64_t model_hash = 0;
+  std::shared_ptr<const HighsPseudocostInitialization> pseudocost;
+  // cuts lower <= sum(cut_value * x) <= cut_upper with lower = -inf
+  std::vector<HighsInt> cut_start;
+  std::vector<HighsInt> cut_index;
+  std::vector<double> cut_value;
+  std::vector<double> cut_upper;
+  // conflicts as sets of bound changes x >= value or x <= value that cannot
+  // hold together in a solution below the objective cutoff
+  std::vector<HighsInt> conflict_start;
+  std::vector<HighsInt> conflict_index;
+  std::vector<double> conflict_value;
+  std::vector<int8_t> conflict_is_lower;
+  // solutions in the order of decreasing quality
+  std::vector<HighsObjectiveSolution> solutions;
+  void clear();
+};
+
 struct RefactorInfo {
   bool use = false;
   std::vector<HighsInt> pivot_row;
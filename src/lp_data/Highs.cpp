@@ -15,6 +15,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <csignal>
 #include <iostream>
 #include <memory>
@@ -25,10 +26,12 @@
 #include "lp_data/HighsInfoDebug.h"
 #include "lp_data/HighsLpSolverObject.h"
 #include "lp_data/HighsSolve.h"
+#include "mip/HighsMipDistributed.h"
 #include "mip/HighsMipSolver.h"
 #include "model/HighsHessianUtils.h"
 #include "parallel/HighsParallel.h"
 #include "presolve/ICrashX.h"
+#include "qpsolver/a_ipm.hpp"
 #include "qpsolver/a_quass.hpp"
 #include "qpsolver/runtime.hpp"
 #include "simplex/HSimplex.h"
@@ -943,7 +946,11 @@ HighsStatus Highs::run() {
     }
   }
   const bool use_simplex_or_ipm = options_.solver.compare(kHighsChooseString);
-  if (!use_simplex_or_ipm) {
+  // A continuous QP is solved by the QP interior point method if IPM
+  // is chosen
+  const bool use_qp_ipm = model_.isQp() && !model_.isMip() &&
+                          options_.solver == kIpmString;
+  if (!use_simplex_or_ipm || use_qp_ipm) {
     // Leaving HiGHS to choose method according to model class
     if (model_.isQp()) {
       if (model_.isMip()) {
@@ -1243,7 +1250,8 @@ HighsStatus Highs::run() {
             model_status_ == HighsModelStatus::kUnboundedOrInfeasible ||
             model_status_ == HighsModelStatus::kTimeLimit ||
             model_status_ == HighsModelStatus::kIterationLimit ||
-            model_status_ == HighsModelStatus::kInterrupt;
+            model_status_ == HighsModelStatus::kInterrupt ||
+            model_status_ == HighsModelStatus::kWorkLimit;
         break;
       }
       case HighsPresolveStatus::kReducedToEmpty: {
@@ -1371,11 +1379,12 @@ HighsStatus Highs::run() {
           solution_ = presolve_.data_.recovered_solution_;
           solution_.value_valid = true;
           //          if (ipx_no_crossover) {
-          if (!basis_.valid) {
+          if (!basis_.valid || !presolve_.data_.recovered_basis_.valid) {
             // Have a primal-dual solution, but no basis, since IPX
             // was used without crossover, either because
             // run_crossover was "off" or "choose" and IPX determined
-            // optimality
+            // optimality, or since postsolve could not recover a
+            // basis
             solution_.dual_valid = true;
             basis_.invalidate();
           } else {
@@ -1484,6 +1493,7 @@ HighsStatus Highs::run() {
            model_status_ == HighsModelStatus::kTimeLimit ||
            model_status_ == HighsModelStatus::kIterationLimit ||
            model_status_ == HighsModelStatus::kInterrupt ||
+           model_status_ == HighsModelStatus::kWorkLimit ||
            model_status_ == HighsModelStatus::kUnknown);
     // The HEkk data correspond to the (strictly reduced) presolved LP
     // so must be cleared
@@ -1561,6 +1571,47 @@ HighsStatus Highs::run() {
   return returnFromRun(return_status);
 }
 
+HighsStatus Highs::resolveLp() {
+  // The lean path is only taken for an LP that simplex has solved
+  // before, so that it only has to continue from the retained simplex
+  // basis after changes to bounds and rows. In all other cases the LP
+  // is solved by run()
+  const bool lean_resolve =
+      called_return_from_run && basis_.valid &&
+      ekk_instance_.status_.has_basis && !model_.isMip() &&
+      !model_.isQp() && !model_.lp_.has_infinite_cost_ &&
+      model_.lp_.num_col_ > 0 && model_.lp_.num_row_ > 0 &&
+      options_.solver.compare(kIpmString) && !options_.icrash &&
+      options_.highs_debug_level <= kHighsDebugLevelMin;
+  if (!lean_resolve) return run();
+
+  // Set this so that calls to returnFromRun() can be checked
+  called_return_from_run = false;
+  model_status_ = HighsModelStatus::kNotset;
+  invalidateInfo();
+  zeroIterationCounts();
+  timer_.startRunHighsClock();
+  if (isBoundInfeasible(options_.log_options, model_.lp_)) {
+    setHighsModelStatusAndClearSolutionAndBasis(HighsModelStatus::kInfeasible);
+    return returnFromRun(HighsStatus::kOk);
+  }
+  timer_.start(timer_.solve_clock);
+  HighsStatus return_status = callSolveLp(model_.lp_, "Re-solving LP");
+  timer_.stop(timer_.solve_clock);
+  return_status = interpretCallStatus(options_.log_options, return_status,
+                                      HighsStatus::kOk, "callSolveLp");
+  if (return_status == HighsStatus::kError)
+    return returnFromRun(return_status);
+  setBasisValidity();
+  // The checks of returnFromRun() only concern data that the simplex
+  // solver has just set consistently, so they are skipped
+  called_return_from_run = true;
+  timer_.stopRunHighsClock();
+  return interpretCallStatus(options_.log_options,
+                             highsStatusFromHighsModelStatus(model_status_),
+                             return_status);
+}
+
 HighsStatus Highs::getDualRay(bool& has_dual_ray, double* dual_ray_value) {
   // Can't get a ray without an INVERT, but absence is only an error
   // when solving an LP #1350
@@ -2007,6 +2058,94 @@ HighsStatus Highs::setHotStart(const HotStart& hot_start) {
   return returnFromHighs(return_status);
 }
 
+HighsStatus Highs::setMipWarmStart(const HighsMipWarmStart& mip_warm_start) {
+  // Check that the user-supplied warm start is valid
+  if (!mip_warm_start.valid) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "setMipWarmStart: invalid MIP warm start\n");
+    return HighsStatus::kError;
+  }
+  mip_warm_start_ = mip_warm_start;
+  return HighsStatus::kOk;
+}
+
+HighsStatus Highs::addMipStart(const HighsInt num_entries,
+                               const HighsInt* index, const double* value) {
+  if (num_entries < 0 || (num_entries > 0 && (!index || !value))) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "addMipStart: invalid MIP start data\n");
+    return HighsStatus::kError;
+  }
+  std::vector<bool> in_start(model_.lp_.num_col_, false);
+  HighsMipStart mip_start;
+  for (HighsInt iEl = 0; iEl < num_entries; iEl++) {
+    const HighsInt iCol = index[iEl];
+    if (iCol < 0 || iCol >= model_.lp_.num_col_ || in_start[iCol]) {
+      highsLogUser(options_.log_options, HighsLogType::kError,
+                   "addMipStart: entry %d has invalid or repeated column "
+                   "index %d\n",
+                   int(iEl), int(iCol));
+      return HighsStatus::kError;
+    }
+    if (!std::isfinite(value[iEl])) {
+      highsLogUser(options_.log_options, HighsLogType::kError,
+                   "addMipStart: entry %d has infinite value\n", int(iEl));
+      return HighsStatus::kError;
+    }
+    in_start[iCol] = true;
+    mip_start.index.push_back(iCol);
+    mip_start.value.push_back(value[iEl]);
+  }
+  mip_starts_.push_back(std::move(mip_start));
+  return HighsStatus::kOk;
+}
+
+HighsStatus Highs::clearMipStarts() {
+  mip_starts_.clear();
+  return HighsStatus::kOk;
+}
+
+HighsStatus Highs::setMipWorkers(
+    const std::vector<std::shared_ptr<HighsMipTransport>>& workers) {
+  for (const std::shared_ptr<HighsMipTransport>& worker : workers) {
+    if (!worker) {
+      highsLogUser(options_.log_options, HighsLogType::kError,
+                   "setMipWorkers: null worker connection\n");
+      return HighsStatus::kError;
+    }
+  }
+  mip_workers_ = workers;
+  return HighsStatus::kOk;
+}
+
+HighsStatus Highs::runMipWorker(HighsMipTransport& transport) {
+  // make sure global scheduler is initialized, since the subtree searches
+  // may use parallelism
+  highs::parallel::initialize_scheduler(options_.threads);
+  return ::runMipWorker(transport, options_);
+}
+
+HighsStatus Highs::runMipWorker(const std::string& socket_path) {
+  HighsSocketListener listener;
+  if (!listener.listen(socket_path)) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "Cannot listen on the socket %s\n", socket_path.c_str());
+    return HighsStatus::kError;
+  }
+  highsLogUser(options_.log_options, HighsLogType::kInfo,
+               "Serving as MIP worker on %s\n", socket_path.c_str());
+  std::unique_ptr<HighsSocketTransport> transport;
+  while ((transport = listener.accept())) {
+    if (runMipWorker(*transport) != HighsStatus::kOk)
+      highsLogUser(options_.log_options, HighsLogType::kWarning,
+                   "Lost the connection to a MIP supervisor\n");
+  }
+  highsLogUser(options_.log_options, HighsLogType::kError,
+               "Cannot accept connections on the socket %s\n",
+               socket_path.c_str());
+  return HighsStatus::kError;
+}
+
 HighsStatus Highs::freezeBasis(HighsInt& frozen_basis_id) {
   frozen_basis_id = kNoLink;
   // Check that there is a simplex basis to freeze
@@ -3249,16 +3388,58 @@ HighsStatus Highs::callSolveQp() {
   settings.iterationlimit = options_.simplex_iteration_limit;
   settings.lambda_zero_threshold = options_.dual_feasibility_tolerance;
 
-  // print header for QP solver output
-  highsLogUser(options_.log_options, HighsLogType::kInfo,
-               "Iteration, Runtime, ObjVal, NullspaceDim\n");
-
   QpModelStatus qp_model_status = QpModelStatus::INDETERMINED;
 
   QpSolution qp_solution(instance);
 
-  QpAsmStatus qpstatus =
-      solveqp(instance, settings, stats, qp_model_status, qp_solution, timer_);
+  QpAsmStatus qpstatus = QpAsmStatus::OK;
+  const bool use_ipm = options_.solver == kIpmString;
+  if (use_ipm) {
+    settings.ipmiterationevent.subscribe([this](Statistics& stats) {
+      int rep = stats.ipm_objval.size() - 1;
+
+      highsLogUser(options_.log_options, HighsLogType::kInfo,
+                   "%d, %lf, %lf, %g, %g, %g\n", rep, stats.ipm_time[rep],
+                   stats.ipm_objval[rep],
+                   stats.ipm_primal_infeasibility[rep],
+                   stats.ipm_dual_infeasibility[rep],
+                   stats.ipm_complementarity[rep]);
+    });
+    settings.ipm_feasibility_tolerance =
+        std::min(options_.primal_feasibility_tolerance,
+                 options_.dual_feasibility_tolerance);
+    settings.ipm_optimality_tolerance = options_.ipm_optimality_tolerance;
+    settings.ipm_iterationlimit = options_.ipm_iteration_limit;
+    settings.ipm_crossover = options_.run_crossover != kHighsOffString;
+
+    // print header for QP interior point solver output
+    highsLogUser(options_.log_options, HighsLogType::kInfo,
+                 "Iteration, Runtime, ObjVal, PrimalInf, DualInf, "
+                 "Complementarity\n");
+    qpstatus = solveqp_ipm(instance, settings, stats, qp_model_status,
+                           qp_solution, timer_);
+    if (stats.ipm_crossover)
+      highsLogUser(options_.log_options, HighsLogType::kInfo,
+                   "QP crossover to a vertex solution completed\n");
+    if (qp_model_status == QpModelStatus::INDETERMINED)
+      highsLogUser(options_.log_options, HighsLogType::kInfo,
+                   "QP interior point solver failed to converge after "
+                   "%" HIGHSINT_FORMAT
+                   " iterations: solving with the active set solver\n",
+                   stats.ipm_iterations);
+  }
+  // The interior point solver leaves the model status indeterminate if
+  // it fails to converge, in which case the QP is solved from scratch
+  // by the active set solver
+  const bool use_ipm_solution =
+      use_ipm && qp_model_status != QpModelStatus::INDETERMINED;
+  if (!use_ipm_solution) {
+    // print header for QP solver output
+    highsLogUser(options_.log_options, HighsLogType::kInfo,
+                 "Iteration, Runtime, ObjVal, NullspaceDim\n");
+    qpstatus = solveqp(instance, settings, stats, qp_model_status, qp_solution,
+                       timer_);
+  }
 
   HighsStatus call_status = HighsStatus::kOk;
   HighsStatus return_status = HighsStatus::kOk;
@@ -3324,7 +3505,8 @@ HighsStatus Highs::callSolveQp() {
       basis_.row_status[i] = HighsBasisStatus::kBasic;
     }
   }
-  basis_.valid = true;
+  // An interior point solution without crossover has no basis
+  basis_.valid = !use_ipm_solution || stats.ipm_crossover;
   basis_.alien = false;
 
   // Get the objective and any KKT failures
@@ -3332,6 +3514,7 @@ HighsStatus Highs::callSolveQp() {
   getKktFailures(options_, model_, solution_, basis_, info_);
   // Set the QP-specific values of info_
   info_.simplex_iteration_count += stats.phase1_iterations;
+  info_.ipm_iteration_count += stats.ipm_iterations;
   info_.qp_iteration_count += stats.num_iterations;
   info_.valid = true;
   if (model_status_ == HighsModelStatus::kOptimal)
@@ -3373,7 +3556,20 @@ HighsStatus Highs::callSolveMip() {
   }
   HighsLp& lp = has_semi_variables ? use_lp : model_.lp_;
   HighsMipSolver solver(callback_, options_, lp, solution_);
+  // A warm start is only used for the next MIP solve
+  if (mip_warm_start_.valid) solver.warmstart = &mip_warm_start_;
+  // The MIP starts are only completed in the next MIP solve
+  if (!mip_starts_.empty()) solver.mipstarts = &mip_starts_;
+  // The workers named by the mip_workers option are only connected for the
+  // duration of this solve
+  std::vector<std::shared_ptr<HighsMipTransport>> mip_workers = mip_workers_;
+  connectMipWorkers(options_.mip_workers, options_.log_options, mip_workers);
+  if (!mip_workers.empty()) solver.workers = &mip_workers;
   solver.run();
+  solver.exportWarmStart(saved_mip_warm_start_);
+  mip_warm_start_.clear();
+  mip_starts_.clear();
+  mip_solution_pool_ = std::move(solver.solution_pool_);
   options_.log_dev_level = log_dev_level;
   // Set the return_status, model status and, for completeness, scaled
   // model status
@@ -3421,12 +3617,21 @@ HighsStatus Highs::callSolveMip() {
   info_.mip_node_count = solver.node_count_;
   info_.mip_dual_bound = solver.dual_bound_;
   info_.mip_gap = solver.gap_;
+  const HighsTreeSizeEstimator& estimate = solver.tree_size_estimate_;
+  info_.mip_tree_weight = estimate.getTreeWeight();
+  info_.mip_remaining_nodes = estimate.getRemainingNodes();
+  info_.mip_remaining_nodes_backtrack = estimate.getRemainingNodesBacktrack();
+  info_.mip_remaining_nodes_tree_weight =
+      estimate.getRemainingNodesTreeWeight();
+  info_.mip_remaining_nodes_gap = estimate.getRemainingNodesGap();
+  info_.mip_remaining_time = estimate.getRemainingTime();
   // Get the number of LP iterations, avoiding overflow if the int64_t
   // value is too large
   int64_t mip_total_lp_iterations = solver.total_lp_iterations_;
   info_.simplex_iteration_count = mip_total_lp_iterations > kHighsIInf
                                       ? -1
                                       : HighsInt(mip_total_lp_iterations);
+  info_.work_count = solver.work_count_;
   info_.valid = true;
   if (model_status_ == HighsModelStatus::kOptimal)
     checkOptimality("MIP", return_status);
@@ -3768,6 +3973,7 @@ HighsStatus Highs::returnFromRun(const HighsStatus run_return_status) {
     case HighsModelStatus::kIterationLimit:
     case HighsModelStatus::kSolutionLimit:
     case HighsModelStatus::kInterrupt:
+    case HighsModelStatus::kWorkLimit:
     case HighsModelStatus::kUnknown:
       assert(return_status == HighsStatus::kWarning);
       break;
@@ -3807,6 +4013,7 @@ HighsStatus Highs::returnFromRun(const HighsStatus run_return_status) {
     case HighsModelStatus::kIterationLimit:
     case HighsModelStatus::kSolutionLimit:
     case HighsModelStatus::kInterrupt:
+    case HighsModelStatus::kWorkLimit:
     case HighsModelStatus::kUnknown:
       // Have info and primal solution (unless infeasible). No primal solution
       // in some other case, too!
@@ -25,6 +25,12 @@ void HighsCallback::clearHighsCallbackDataOut() {
   this->data_out.mip_primal_bound = kHighsInf;
   this->data_out.mip_dual_bound = -kHighsInf;
   this->data_out.mip_gap = -1;
+  this->data_out.mip_tree_weight = -1;
+  this->data_out.mip_remaining_nodes = kHighsInf;
+  this->data_out.mip_remaining_nodes_backtrack = kHighsInf;
+  this->data_out.mip_remaining_nodes_tree_weight = kHighsInf;
+  this->data_out.mip_remaining_nodes_gap = kHighsInf;
+  this->data_out.mip_remaining_time = kHighsInf;
   this->data_out.mip_solution = nullptr;
 }
 
@@ -26,6 +26,12 @@ struct HighsCallbackDataOut {
   double mip_primal_bound;
   double mip_dual_bound;
   double mip_gap;
+  double mip_tree_weight;
+  double mip_remaining_nodes;
+  double mip_remaining_nodes_backtrack;
+  double mip_remaining_nodes_tree_weight;
+  double mip_remaining_nodes_gap;
+  double mip_remaining_time;
   double* mip_solution;
 };
 
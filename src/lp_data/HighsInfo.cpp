@@ -24,12 +24,19 @@ void HighsInfo::invalidate() {
   ipm_iteration_count = -1;
   crossover_iteration_count = -1;
   qp_iteration_count = -1;
+  work_count = -1;
   primal_solution_status = kSolutionStatusNone;
   dual_solution_status = kSolutionStatusNone;
   basis_validity = kBasisValidityInvalid;
   objective_function_value = 0;
   mip_dual_bound = 0;
   mip_gap = kHighsInf;
+  mip_tree_weight = 0;
+  mip_remaining_nodes = kHighsInf;
+  mip_remaining_nodes_backtrack = kHighsInf;
+  mip_remaining_nodes_tree_weight = kHighsInf;
+  mip_remaining_nodes_gap = kHighsInf;
+  mip_remaining_time = kHighsInf;
   max_integrality_violation = kHighsIllegalInfeasibilityMeasure;
   num_primal_infeasibilities = kHighsIllegalInfeasibilityCount;
   max_primal_infeasibility = kHighsIllegalInfeasibilityMeasure;
@@ -139,12 +139,19 @@ struct HighsInfoStruct {
   HighsInt ipm_iteration_count;
   HighsInt crossover_iteration_count;
   HighsInt qp_iteration_count;
+  int64_t work_count;
   HighsInt primal_solution_status;
   HighsInt dual_solution_status;
   HighsInt basis_validity;
   double objective_function_value;
   double mip_dual_bound;
   double mip_gap;
+  double mip_tree_weight;
+  double mip_remaining_nodes;
+  double mip_remaining_nodes_backtrack;
+  double mip_remaining_nodes_tree_weight;
+  double mip_remaining_nodes_gap;
+  double mip_remaining_time;
   double max_integrality_violation;
   HighsInt num_primal_infeasibilities;
   double max_primal_infeasibility;
@@ -221,6 +228,11 @@ class HighsInfo : public HighsInfoStruct {
                           advanced, &qp_iteration_count, 0);
     records.push_back(record_int);
 
+    record_int64 = new InfoRecordInt64(
+        "work_count", "Deterministic work count of the simplex and MIP solvers",
+        advanced, &work_count, 0);
+    records.push_back(record_int64);
+
     record_int = new InfoRecordInt("primal_solution_status",
                                    "Model primal solution status: 0 => No "
                                    "solution; 1 => Infeasible point; "
@@ -261,6 +273,46 @@ class HighsInfo : public HighsInfoStruct {
                                          advanced, &mip_gap, 0);
     records.push_back(record_double);
 
+    record_double = new InfoRecordDouble(
+        "mip_tree_weight",
+        "MIP solver fraction of the search tree of the current run explored",
+        advanced, &mip_tree_weight, 0);
+    records.push_back(record_double);
+
+    record_double = new InfoRecordDouble(
+        "mip_remaining_nodes",
+        "MIP solver estimate of the number of nodes remaining in the current "
+        "run: upper median of the estimates of the three methods",
+        advanced, &mip_remaining_nodes, kHighsInf);
+    records.push_back(record_double);
+
+    record_double = new InfoRecordDouble(
+        "mip_remaining_nodes_backtrack",
+        "MIP solver estimate of the number of remaining nodes by weighted "
+        "backtrack estimation",
+        advanced, &mip_remaining_nodes_backtrack, kHighsInf);
+    records.push_back(record_double);
+
+    record_double = new InfoRecordDouble(
+        "mip_remaining_nodes_tree_weight",
+        "MIP solver estimate of the number of remaining nodes by tree weight "
+        "extrapolation",
+        advanced, &mip_remaining_nodes_tree_weight, kHighsInf);
+    records.push_back(record_double);
+
+    record_double = new InfoRecordDouble(
+        "mip_remaining_nodes_gap",
+        "MIP solver estimate of the number of remaining nodes by the rate at "
+        "which the gap is closed",
+        advanced, &mip_remaining_nodes_gap, kHighsInf);
+    records.push_back(record_double);
+
+    record_double = new InfoRecordDouble(
+        "mip_remaining_time",
+        "MIP solver estimate of the time to complete the current run",
+        advanced, &mip_remaining_time, kHighsInf);
+    records.push_back(record_double);
+
     record_double = new InfoRecordDouble("max_integrality_violation",
                                          "Max integrality violation", advanced,
                                          &max_integrality_violation, 0);
@@ -50,6 +50,7 @@ HighsDebugStatus debugInfo(const HighsOptions& options, const HighsLp& lp,
     case HighsModelStatus::kTimeLimit:
     case HighsModelStatus::kIterationLimit:
     case HighsModelStatus::kSolutionLimit:
+    case HighsModelStatus::kWorkLimit:
     case HighsModelStatus::kUnknown:
       // Should have info
       assert(have_info == true);
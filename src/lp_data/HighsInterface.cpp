@@ -1394,6 +1394,7 @@ void Highs::zeroIterationCounts() {
   info_.ipm_iteration_count = 0;
   info_.crossover_iteration_count = 0;
   info_.qp_iteration_count = 0;
+  info_.work_count = 0;
 }
 
 HighsStatus Highs::getDualRayInterface(bool& has_dual_ray,
@@ -1263,6 +1263,9 @@ std::string utilModelStatusToString(const HighsModelStatus model_status) {
     case HighsModelStatus::kInterrupt:
       return "Interrupted by user";
       break;
+    case HighsModelStatus::kWorkLimit:
+      return "Work limit reached";
+      break;
     case HighsModelStatus::kUnknown:
       return "Unknown";
       break;
@@ -1301,6 +1304,8 @@ std::string utilPresolveRuleTypeToString(const HighsInt rule_type) {
     return "Aggregator";
   } else if (rule_type == kPresolveRuleParallelRowsAndCols) {
     return "Parallel rows and columns";
+  } else if (rule_type == kPresolveRuleOrbitalAggregation) {
+    return "Orbital aggregation";
   }
   assert(1 == 0);
   return "????";
@@ -1343,6 +1348,8 @@ HighsStatus highsStatusFromHighsModelStatus(HighsModelStatus model_status) {
       return HighsStatus::kWarning;
     case HighsModelStatus::kInterrupt:
       return HighsStatus::kWarning;
+    case HighsModelStatus::kWorkLimit:
+      return HighsStatus::kWarning;
     case HighsModelStatus::kUnknown:
       return HighsStatus::kWarning;
     default:
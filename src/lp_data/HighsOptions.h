@@ -302,6 +302,7 @@ struct HighsOptionsStruct {
   double ipm_optimality_tolerance;
   double objective_bound;
   double objective_target;
+  double work_limit;
   HighsInt threads;
   HighsInt highs_debug_level;
   HighsInt highs_analysis_level;
@@ -381,13 +382,29 @@ struct HighsOptionsStruct {
   bool mip_detect_symmetry;
   HighsInt mip_max_nodes;
   HighsInt mip_max_stall_nodes;
+  bool mip_parallel_tree_search;
+  HighsInt mip_subtree_node_limit;
+  double mip_subtree_restart_fixing_rate;
+  HighsInt mip_root_racers;
+  bool mip_parallel_strong_branching;
+  HighsInt mip_node_memory_limit;
+  bool mip_parallel_separation;
+  bool mip_lns_portfolio;
+  bool mip_concurrent_lns;
+  std::string mip_checkpoint_file;
+  double mip_checkpoint_interval;
+  std::string mip_resume_file;
+  std::string mip_workers;
+  std::string mip_worker_socket;
   HighsInt mip_max_leaves;
   HighsInt mip_max_improving_sols;
+  HighsInt mip_solution_pool_size;
   HighsInt mip_lp_age_limit;
   HighsInt mip_pool_age_limit;
   HighsInt mip_pool_soft_limit;
   HighsInt mip_pscost_minreliable;
   HighsInt mip_min_cliquetable_entries_for_parallelism;
+  HighsInt mip_min_propagation_nnz_for_parallelism;
   HighsInt mip_report_level;
   double mip_feasibility_tolerance;
   double mip_rel_gap;
@@ -472,8 +489,10 @@ class HighsOptions : public HighsOptionsStruct {
     record_string = new OptionRecordString(
         kSolverString,
         "Solver option: \"simplex\", \"choose\" or \"ipm\". If "
-        "\"simplex\"/\"ipm\" is chosen then, for a MIP (QP) the integrality "
-        "constraint (quadratic term) will be ignored",
+        "\"simplex\"/\"ipm\" is chosen then, for a MIP the integrality "
+        "constraint will be ignored. If \"simplex\" is chosen then, for a "
+        "QP the quadratic term will be ignored, and if \"ipm\" is chosen "
+        "then a QP is solved by the QP interior point solver",
         advanced, &solver, kHighsChooseString);
     records.push_back(record_string);
 
@@ -556,6 +575,12 @@ class HighsOptions : public HighsOptionsStruct {
         &objective_target, -kHighsInf, -kHighsInf, kHighsInf);
     records.push_back(record_double);
 
+    record_double = new OptionRecordDouble(
+        "work_limit",
+        "Limit on the deterministic work count of the simplex and MIP solvers",
+        advanced, &work_limit, 0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
     record_int =
         new OptionRecordInt(kRandomSeedString, "Random seed used in HiGHS",
                             advanced, &random_seed, 0, 0, kHighsIInf);
@@ -757,6 +782,111 @@ class HighsOptions : public HighsOptionsStruct {
         "MIP solver max number of nodes where estimate is above cutoff bound",
         advanced, &mip_max_stall_nodes, 0, kHighsIInf, kHighsIInf);
     records.push_back(record_int);
+
+    record_bool = new OptionRecordBool(
+        "mip_parallel_tree_search",
+        "Whether the MIP solver should search subtrees of open nodes in "
+        "parallel deterministic rounds when more than one thread is available",
+        advanced, &mip_parallel_tree_search, false);
+    records.push_back(record_bool);
+
+    record_int = new OptionRecordInt(
+        "mip_subtree_node_limit",
+        "Node limit for each subtree searched in a round of the parallel MIP "
+        "tree search and for each subtree restart",
+        advanced, &mip_subtree_node_limit, 1, 1000, kHighsIInf);
+    records.push_back(record_int);
+
+    record_double = new OptionRecordDouble(
+        "mip_subtree_restart_fixing_rate",
+        "Fraction of the integer columns fixed in the local domain of a MIP "
+        "node above which the subtree of the node is presolved and solved as "
+        "a sub-MIP: no subtree restarts for a value of 1",
+        advanced, &mip_subtree_restart_fixing_rate, 0, 1, 1);
+    records.push_back(record_double);
+
+    record_int = new OptionRecordInt(
+        "mip_root_racers",
+        "Number of additional threads that process the MIP root node with "
+        "diversified settings, sharing their cuts, solutions and bound changes",
+        advanced, &mip_root_racers, 0, 0, kHighsIInf);
+    records.push_back(record_int);
+
+    record_bool = new OptionRecordBool(
+        "mip_parallel_strong_branching",
+        "Whether the MIP solver should evaluate strong branching candidates "
+        "in parallel when more than one thread is available",
+        advanced, &mip_parallel_strong_branching, false);
+    records.push_back(record_bool);
+
+    record_int = new OptionRecordInt(
+        "mip_node_memory_limit",
+        "Memory in MB for the domain changes of open nodes in the MIP solver "
+        "beyond which low priority nodes are moved to a temporary file",
+        advanced, &mip_node_memory_limit, 0, kHighsIInf, kHighsIInf);
+    records.push_back(record_int);
+
+    record_bool = new OptionRecordBool(
+        "mip_parallel_separation",
+        "Whether the MIP solver should run the LP based separators "
+        "concurrently when more than one thread is available",
+        advanced, &mip_parallel_separation, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_lns_portfolio",
+        "Whether the MIP solver should select the large neighbourhood search "
+        "heuristic of a dive from RINS, local branching, crossover, DINS and "
+        "proximity search by their payoff per effort",
+        advanced, &mip_lns_portfolio, false);
+    records.push_back(record_bool);
+
+    record_bool = new OptionRecordBool(
+        "mip_concurrent_lns",
+        "Whether the MIP solver should solve the sub-MIPs of the large "
+        "neighbourhood search portfolio concurrently with the tree search when "
+        "more than one thread is available",
+        advanced, &mip_concurrent_lns, false);
+    records.push_back(record_bool);
+
+    record_string = new OptionRecordString(
+        "mip_checkpoint_file",
+        "File to which the state of the MIP branch-and-bound search is written "
+        "when the search is interrupted and every mip_checkpoint_interval "
+        "seconds: not written for an empty string \"\"",
+        advanced, &mip_checkpoint_file, kHighsFilenameDefault);
+    records.push_back(record_string);
+
+    record_double = new OptionRecordDouble(
+        "mip_checkpoint_interval",
+        "Time in seconds between two checkpoints of the MIP branch-and-bound "
+        "search",
+        advanced, &mip_checkpoint_interval, 0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
+    record_string = new OptionRecordString(
+        "mip_resume_file",
+        "Checkpoint file of an interrupted solve of the same MIP from which "
+        "the branch-and-bound search is resumed: not used for an empty string "
+        "\"\"",
+        advanced, &mip_resume_file, kHighsFilenameDefault);
+    records.push_back(record_string);
+
+    record_string = new OptionRecordString(
+        "mip_workers",
+        "Comma separated list of the Unix sockets of worker processes to "
+        "which the MIP solver sends subtrees of the branch-and-bound search: "
+        "the search is not distributed for an empty string \"\"",
+        advanced, &mip_workers, kHighsFilenameDefault);
+    records.push_back(record_string);
+
+    record_string = new OptionRecordString(
+        "mip_worker_socket",
+        "Unix socket on which the HiGHS executable serves as a worker of "
+        "distributed MIP solves instead of solving a model: not used for an "
+        "empty string \"\"",
+        advanced, &mip_worker_socket, kHighsFilenameDefault);
+    records.push_back(record_string);
 #ifdef HIGHS_DEBUGSOL
     record_string = new OptionRecordString(
         "mip_debug_solution_file",
@@ -796,6 +926,13 @@ class HighsOptions : public HighsOptionsStruct {
         advanced, &mip_max_improving_sols, 1, kHighsIInf, kHighsIInf);
     records.push_back(record_int);
 
+    record_int = new OptionRecordInt(
+        "mip_solution_pool_size",
+        "Number of the best distinct feasible solutions found by the MIP "
+        "solver that are kept in its solution pool",
+        advanced, &mip_solution_pool_size, 0, 10, kHighsIInf);
+    records.push_back(record_int);
+
     record_int = new OptionRecordInt(
         "mip_lp_age_limit",
         "Maximal age of dynamic LP rows before "
@@ -833,6 +970,15 @@ class HighsOptions : public HighsOptionsStruct {
         kHighsIInf);
     records.push_back(record_int);
 
+    record_int = new OptionRecordInt(
+        "mip_min_propagation_nnz_for_parallelism",
+        "Minimal number of nonzeros in the rows of a MIP solver domain "
+        "propagation round before the rows are propagated using parallel "
+        "processing",
+        advanced, &mip_min_propagation_nnz_for_parallelism, 0, 10000,
+        kHighsIInf);
+    records.push_back(record_int);
+
     record_int =
         new OptionRecordInt("mip_report_level", "MIP solver reporting level",
                             now_advanced, &mip_report_level, 0, 1, 2);
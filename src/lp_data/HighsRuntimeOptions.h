@@ -265,7 +265,9 @@ bool loadOptions(const HighsLogOptions& report_log_options, int argc,
     model_file = "ml.mps";
   }
 
-  if (model_file.size() == 0) {
+  // A worker of distributed MIP solves receives its models from the
+  // supervisor
+  if (model_file.size() == 0 && options.mip_worker_socket.empty()) {
     std::cout << "Please specify filename in .mps|.lp|.ems format.\n";
     return false;
   }
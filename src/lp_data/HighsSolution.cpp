@@ -1408,6 +1408,21 @@ void HighsSolution::clear() {
 
 void HighsObjectiveSolution::clear() { this->col_value.clear(); }
 
+void HighsMipWarmStart::clear() {
+  this->valid = false;
+  this->model_hash = 0;
+  this->pseudocost.reset();
+  this->cut_start.clear();
+  this->cut_index.clear();
+  this->cut_value.clear();
+  this->cut_upper.clear();
+  this->conflict_start.clear();
+  this->conflict_index.clear();
+  this->conflict_value.clear();
+  this->conflict_is_lower.clear();
+  this->solutions.clear();
+}
+
 void HighsBasis::invalidate() {
   this->valid = false;
   this->alien = true;
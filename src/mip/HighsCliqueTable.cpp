@@ -437,6 +437,67 @@ void HighsCliqueTable::doAddClique(const CliqueVar* cliquevars,
                    cliqueentries[cliques[cliqueid].start + 1]),
         cliqueid);
 }
+
+// a neighbourhood query is answered from a bitset of the neighbours of the
+// vertex if it has at least this many vertices and the cliques of the vertex
+// have at most kNeighbourhoodBitsetEntriesPerVertex entries per queried vertex
+static constexpr HighsInt kMinNeighbourhoodBitsetQueries = 32;
+static constexpr HighsInt kNeighbourhoodBitsetEntriesPerVertex = 16;
+
+bool HighsCliqueTable::queryNeighbourhoodBitset(
+    std::vector<HighsInt>& neighbourhoodInds, CliqueVar v, const CliqueVar* q,
+    HighsInt N) const {
+  if (N < kMinNeighbourhoodBitsetQueries) return false;
+
+  // count the entries of the cliques of v and give up as soon as there are
+  // too many of them for the bitset to pay off
+  const int64_t maxNeighbourEntries =
+      int64_t{kNeighbourhoodBitsetEntriesPerVertex} * N;
+  int64_t numNeighbourEntries = 0;
+  HighsInt numLargeCliques = 0;
+  bool tooManyEntries =
+      invertedHashList[v.index()].for_each([&](HighsInt cliqueid) {
+        numNeighbourEntries += cliques[cliqueid].end - cliques[cliqueid].start;
+        ++numLargeCliques;
+        return numNeighbourEntries > maxNeighbourEntries;
+      });
+  numNeighbourEntries += 2 * (numcliquesvar[v.index()] - numLargeCliques);
+  if (tooManyEntries || numNeighbourEntries > maxNeighbourEntries)
+    return false;
+
+  // the bitset is kept per thread, all of its words are zero between queries
+  static thread_local std::vector<uint64_t> neighbourBits;
+  if (neighbourBits.size() < (invertedHashList.size() + 63) / 64)
+    neighbourBits.resize((invertedHashList.size() + 63) / 64);
+
+  auto markNeighbours = [&](HighsInt cliqueid) {
+    for (HighsInt i = cliques[cliqueid].start; i != cliques[cliqueid].end;
+         ++i) {
+      HighsInt index = cliqueentries[i].index();
+      neighbourBits[index >> 6] |= uint64_t{1} << (index & 63);
+    }
+  };
+  invertedHashList[v.index()].for_each(markNeighbours);
+  invertedHashListSizeTwo[v.index()].for_each(markNeighbours);
+
+  for (HighsInt i = 0; i < N; ++i) {
+    HighsInt index = q[i].index();
+    if (q[i].col != v.col &&
+        (neighbourBits[index >> 6] >> (index & 63)) & uint64_t{1})
+      neighbourhoodInds.push_back(i);
+  }
+
+  auto clearNeighbours = [&](HighsInt cliqueid) {
+    for (HighsInt i = cliques[cliqueid].start; i != cliques[cliqueid].end;
+         ++i)
+      neighbourBits[cliqueentries[i].index() >> 6] = 0;
+  };
+  invertedHashList[v.index()].for_each(clearNeighbours);
+  invertedHashListSizeTwo[v.index()].for_each(clearNeighbours);
+
+  return true;
+}
+
 struct ThreadNeighbourhoodQueryData {
   int64_t numQueries;
   std::vector<HighsInt> neighbourhoodInds;
@@ -449,7 +510,11 @@ void HighsCliqueTable::queryNeighbourhood(
 
   if (numCliques(v) == 0) return;
 
-  if (numEntries - sizeTwoCliques.size() * 2 < minEntriesForParallelism) {
+  if (queryNeighbourhoodBitset(neighbourhoodInds, v, q, N)) {
+    // count the queries as if each vertex had been queried on its own
+    numQueries += N;
+  } else if (numEntries - sizeTwoCliques.size() * 2 <
+             minEntriesForParallelism) {
     for (HighsInt i = 0; i < N; ++i) {
       if (haveCommonClique(numQueries, v, q[i])) neighbourhoodInds.push_back(i);
     }
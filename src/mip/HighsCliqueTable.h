@@ -154,6 +154,10 @@ class HighsCliqueTable {
                           int64_t& numNeighbourhoodqueries, CliqueVar v,
                           CliqueVar* q, HighsInt N) const;
 
+  bool queryNeighbourhoodBitset(std::vector<HighsInt>& neighbourhoodInds,
+                                CliqueVar v, const CliqueVar* q,
+                                HighsInt N) const;
+
  public:
   int64_t numNeighbourhoodQueries;
 
@@ -11,11 +11,14 @@
 
 #include "mip/HighsConflictPool.h"
 
+#include <algorithm>
+
+
 #include "mip/HighsDomain.h"
 
 void HighsConflictPool::addConflictCut(
     const HighsDomain& domain,
-    const std::set<HighsDomain::ConflictSet::LocalDomChg>& reasonSideFrontier) {
+    const HighsDomain::ConflictSet::Frontier& reasonSideFrontier) {
   HighsInt conflictIndex;
   HighsInt start;
   HighsInt end;
@@ -85,8 +88,7 @@ void HighsConflictPool::addConflictCut(
 
 void HighsConflictPool::addReconvergenceCut(
     const HighsDomain& domain,
-    const std::set<HighsDomain::ConflictSet::LocalDomChg>&
-        reconvergenceFrontier,
+    const HighsDomain::ConflictSet::Frontier& reconvergenceFrontier,
     const HighsDomainChange& reconvergenceDomchg) {
   HighsInt conflictIndex;
   HighsInt start;
@@ -157,6 +159,57 @@ void HighsConflictPool::addReconvergenceCut(
     conflictProp->conflictAdded(conflictIndex);
 }
 
+void HighsConflictPool::addConflictCut(
+    const std::vector<HighsDomainChange>& conflict) {
+  HighsInt conflictIndex;
+  HighsInt start;
+  HighsInt end;
+  HighsInt conflictLen = conflict.size();
+  std::set<std::pair<HighsInt, HighsInt>>::iterator it;
+  if (freeSpaces_.empty() ||
+      (it = freeSpaces_.lower_bound(
+           std::make_pair(conflictLen, HighsInt{-1}))) == freeSpaces_.end()) {
+    start = conflictEntries_.size();
+    end = start + conflictLen;
+
+    conflictEntries_.resize(end);
+  } else {
+    std::pair<HighsInt, HighsInt> freeslot = *it;
+    freeSpaces_.erase(it);
+
+    start = freeslot.second;
+    end = start + conflictLen;
+    // if the space was not completely occupied, we register the remainder of
+    // it again in the priority queue
+    if (freeslot.first > conflictLen) {
+      freeSpaces_.emplace(freeslot.first - conflictLen, end);
+    }
+  }
+
+  // register the range of entries for this conflict with a reused or a new
+  // index
+  if (deletedConflicts_.empty()) {
+    conflictIndex = conflictRanges_.size();
+    conflictRanges_.emplace_back(start, end);
+    ages_.resize(conflictRanges_.size());
+    modification_.resize(conflictRanges_.size());
+  } else {
+    conflictIndex = deletedConflicts_.back();
+    deletedConflicts_.pop_back();
+    conflictRanges_[conflictIndex].first = start;
+    conflictRanges_[conflictIndex].second = end;
+  }
+
+  modification_[conflictIndex] += 1;
+  ages_[conflictIndex] = 0;
+  ageDistribution_[ages_[conflictIndex]] += 1;
+
+  std::copy(conflict.begin(), conflict.end(), conflictEntries_.begin() + start);
+
+  for (HighsDomain::ConflictPoolPropagation* conflictProp : propagationDomains)
+    conflictProp->conflictAdded(conflictIndex);
+}
+
 void HighsConflictPool::removeConflict(HighsInt conflict) {
   for (HighsDomain::ConflictPoolPropagation* conflictProp : propagationDomains)
     conflictProp->conflictDeleted(conflict);
@@ -52,16 +52,19 @@ class HighsConflictPool {
     ageDistribution_.resize(agelim_ + 1);
   }
 
-  void addConflictCut(const HighsDomain& domain,
-                      const std::set<HighsDomain::ConflictSet::LocalDomChg>&
-                          reasonSideFrontier);
+  void addConflictCut(
+      const HighsDomain& domain,
+      const HighsDomain::ConflictSet::Frontier& reasonSideFrontier);
 
   void addReconvergenceCut(
       const HighsDomain& domain,
-      const std::set<HighsDomain::ConflictSet::LocalDomChg>&
-          reconvergenceFrontier,
+      const HighsDomain::ConflictSet::Frontier& reconvergenceFrontier,
       const HighsDomainChange& reconvergenceDomchg);
 
+  /// adds a conflict with the given entries, which are taken as they are, e.g.
+  /// from a checkpoint of another conflict pool
+  void addConflictCut(const std::vector<HighsDomainChange>& conflict);
+
   void removeConflict(HighsInt conflict);
 
   void performAging();
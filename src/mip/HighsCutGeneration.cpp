@@ -1073,6 +1073,9 @@ bool HighsCutGeneration::generateCut(HighsTransformedLp& transLp,
                                      std::vector<HighsInt>& inds_,
                                      std::vector<double>& vals_, double& rhs_,
                                      bool onlyInitialCMIRScale) {
+  // the work of the cut generation is counted as the length of the base
+  // inequality
+  lpRelaxation.getMipSolver().mipdata_->addWork(inds_.size());
 #if 0
   if (vals_.size() > 1) {
     std::vector<HighsInt> indsCheck_ = inds_;
@@ -33,6 +33,19 @@ static uint64_t compute_cut_hash(const HighsInt* Rindex, const double* Rvalue,
          (HighsHashHelpers::vector_hash(valueHashCodes.data(), Rlen) >> 32);
 }
 
+// bit set of the hashed column indices of a cut, cuts whose sketches do not
+// intersect have disjoint supports
+static uint64_t compute_support_sketch(const HighsInt* Rindex,
+                                       const HighsInt Rlen) {
+  uint64_t sketch = 0;
+  for (HighsInt i = 0; i < Rlen; ++i)
+    sketch |= uint64_t{1} << ((uint64_t(Rindex[i]) *
+                               HighsHashHelpers::fibonacci_muliplier()) >>
+                              58);
+
+  return sketch;
+}
+
 #if 0
 static void printCut(const HighsInt* Rindex, const double* Rvalue, HighsInt Rlen,
                      double rhs) {
@@ -166,6 +179,7 @@ void HighsCutPool::performAging() {
   }
 
   assert((HighsInt)propRows.size() == numPropRows);
+  matrix_.compact();
 }
 
 void HighsCutPool::separate(const std::vector<double>& sol, HighsDomain& domain,
@@ -186,6 +200,9 @@ void HighsCutPool::separate(const std::vector<double>& sol, HighsDomain& domain,
     --agelim;
   }
 
+  // the violations of all cuts that are not in the LP are computed in one
+  // pass over the rows before the ages are updated, which removes rows
+  violations_.resize(nrows);
   for (HighsInt i = 0; i < nrows; ++i) {
     // cuts with an age of -1 are already in the LP and are therefore skipped
     if (ages_[i] < 0) continue;
@@ -195,12 +212,18 @@ void HighsCutPool::separate(const std::vector<double>& sol, HighsDomain& domain,
 
     double viol(-rhs_[i]);
 
-    for (HighsInt j = start; j != end; ++j) {
-      HighsInt col = ARindex[j];
-      double solval = sol[col];
+    for (HighsInt j = start; j != end; ++j)
+      viol += ARvalue[j] * sol[ARindex[j]];
 
-      viol += ARvalue[j] * solval;
-    }
+    violations_[i] = viol;
+  }
+
+  for (HighsInt i = 0; i < nrows; ++i) {
+    if (ages_[i] < 0) continue;
+
+    HighsInt start = matrix_.getRowStart(i);
+    HighsInt end = matrix_.getRowEnd(i);
+    double viol = violations_[i];
 
     // if the cut is not violated more than feasibility tolerance
     // we skip it and increase its age, otherwise we reset its age
@@ -273,6 +296,11 @@ void HighsCutPool::separate(const std::vector<double>& sol, HighsDomain& domain,
     efficacious_cuts.emplace_back(score, i);
   }
   assert((HighsInt)propRows.size() == numPropRows);
+  // the rows deleted by the aging may leave the storage fragmented, which
+  // moves the remaining rows
+  matrix_.compact();
+  ARindex = matrix_.getARindex();
+  ARvalue = matrix_.getARvalue();
   if (efficacious_cuts.empty()) return;
 
   pdqsort(efficacious_cuts.begin(), efficacious_cuts.end(),
@@ -318,14 +346,37 @@ void HighsCutPool::separate(const std::vector<double>& sol, HighsDomain& domain,
 
   assert(cutset.empty());
 
+  // The parallelism of a candidate with the selected cuts is computed from a
+  // dense copy of the candidate, which is only needed for the selected cuts
+  // whose support may intersect with the support of the candidate. The sum
+  // runs over the common columns in the same order as in getParallelism().
+  denseCut_.resize(sol.size());
   for (const std::pair<double, HighsInt>& p : efficacious_cuts) {
     bool discard = false;
     double maxpar = 0.1;
-    for (HighsInt k : cutset.cutindices) {
-      if (getParallelism(k, p.second) > maxpar) {
-        discard = true;
-        break;
+    if (!cutset.cutindices.empty()) {
+      HighsInt start = matrix_.getRowStart(p.second);
+      HighsInt end = matrix_.getRowEnd(p.second);
+      for (HighsInt j = start; j != end; ++j)
+        denseCut_[ARindex[j]] = ARvalue[j];
+
+      for (HighsInt k : cutset.cutindices) {
+        if ((supportSketch_[k] & supportSketch_[p.second]) == 0) continue;
+
+        double dotprod = 0.0;
+        HighsInt kstart = matrix_.getRowStart(k);
+        HighsInt kend = matrix_.getRowEnd(k);
+        for (HighsInt j = kstart; j != kend; ++j)
+          dotprod += ARvalue[j] * denseCut_[ARindex[j]];
+
+        if (dotprod * rownormalization_[k] * rownormalization_[p.second] >
+            maxpar) {
+          discard = true;
+          break;
+        }
       }
+
+      for (HighsInt j = start; j != end; ++j) denseCut_[ARindex[j]] = 0.0;
     }
 
     if (discard) continue;
@@ -501,6 +552,7 @@ HighsInt HighsCutPool::addCut(const HighsMipSolver& mipsolver, HighsInt* Rindex,
     rownormalization_.resize(rowindex + 1);
     maxabscoef_.resize(rowindex + 1);
     rowintegral.resize(rowindex + 1);
+    supportSketch_.resize(rowindex + 1);
   }
 
   // set the right hand side and reset the age
@@ -513,6 +565,7 @@ HighsInt HighsCutPool::addCut(const HighsMipSolver& mipsolver, HighsInt* Rindex,
 
   rownormalization_[rowindex] = normalization;
   maxabscoef_[rowindex] = maxabscoef;
+  supportSketch_[rowindex] = compute_support_sketch(Rindex, Rlen);
 
   // printf("density: %.2f%%\n", 100.0 * Rlen / (double)matrix_.numCols());
   for (HighsDomain::CutpoolPropagation* propagationdomain : propagationDomains)
@@ -59,6 +59,7 @@ class HighsCutPool {
   std::vector<double> rownormalization_;
   std::vector<double> maxabscoef_;
   std::vector<uint8_t> rowintegral;
+  std::vector<uint64_t> supportSketch_;
   std::unordered_multimap<uint64_t, HighsInt> hashToCutMap;
   std::vector<HighsDomain::CutpoolPropagation*> propagationDomains;
   std::set<std::pair<HighsInt, HighsInt>> propRows;
@@ -74,6 +75,8 @@ class HighsCutPool {
   HighsInt numPropRows;
   std::vector<HighsInt> ageDistribution;
   std::vector<std::pair<HighsInt, double>> sortBuffer;
+  std::vector<double> violations_;
+  std::vector<double> denseCut_;
 
   bool isDuplicate(size_t hash, double norm, const HighsInt* Rindex,
                    const double* Rvalue, HighsInt Rlen, double rhs);
@@ -76,12 +76,11 @@ struct HighsDebugSol {
                 double vlbconstant) const;
 
   void checkConflictReasonFrontier(
-      const std::set<HighsDomain::ConflictSet::LocalDomChg>& reasonSideFrontier,
+      const HighsDomain::ConflictSet::Frontier& reasonSideFrontier,
       const std::vector<HighsDomainChange>& domchgstack) const;
 
   void checkConflictReconvergenceFrontier(
-      const std::set<HighsDomain::ConflictSet::LocalDomChg>&
-          reconvergenceFrontier,
+      const HighsDomain::ConflictSet::Frontier& reconvergenceFrontier,
       const HighsDomain::ConflictSet::LocalDomChg& reconvDomchgPos,
       const std::vector<HighsDomainChange>& domchgstack) const;
 };
@@ -128,12 +127,11 @@ struct HighsDebugSol {
                 double vlbconstant) const {}
 
   void checkConflictReasonFrontier(
-      const std::set<HighsDomain::ConflictSet::LocalDomChg>& reasonSideFrontier,
+      const HighsDomain::ConflictSet::Frontier& reasonSideFrontier,
       const std::vector<HighsDomainChange>& domchgstack) const {}
 
   void checkConflictReconvergenceFrontier(
-      const std::set<HighsDomain::ConflictSet::LocalDomChg>&
-          reconvergenceFrontier,
+      const HighsDomain::ConflictSet::Frontier& reconvergenceFrontier,
       const HighsDomain::ConflictSet::LocalDomChg& reconvDomchgPos,
       const std::vector<HighsDomainChange>& domchgstack) const {}
 };
@@ -18,8 +18,37 @@
 #include "mip/HighsConflictPool.h"
 #include "mip/HighsCutPool.h"
 #include "mip/HighsMipSolverData.h"
+#include "parallel/HighsParallel.h"
 #include "pdqsort/pdqsort.h"
 
+// approximate number of nonzeros that one task processes when the rows of a
+// propagation round are processed in parallel
+static constexpr HighsInt kParallelPropTaskNnz = 2000;
+
+// Calls propagateIndex for each of the rows of a propagation round. The calls
+// for different rows only write to data of their own row and run in parallel
+// when the rows have at least minParallelNnz nonzeros. The bound changes they
+// compute are applied afterwards in the order of the rows, so the result does
+// not depend on the number of threads.
+template <typename F>
+static void propagateRows(HighsInt numproprows, HighsInt propnnz,
+                          HighsInt minParallelNnz, F&& propagateIndex) {
+  if (numproprows < 2 || propnnz < minParallelNnz) {
+    for (HighsInt k = 0; k != numproprows; ++k) propagateIndex(k);
+    return;
+  }
+
+  HighsInt grainSize = std::max(
+      HighsInt{1},
+      HighsInt(int64_t{numproprows} * kParallelPropTaskNnz / propnnz));
+  highs::parallel::for_each(
+      0, numproprows,
+      [&](HighsInt start, HighsInt end) {
+        for (HighsInt k = start; k != end; ++k) propagateIndex(k);
+      },
+      grainSize);
+}
+
 static double activityContributionMin(double coef, const double& lb,
                                       const double& ub) {
   if (coef < 0) {
@@ -2389,6 +2418,10 @@ bool HighsDomain::propagate() {
 
   if (!havePropagationRows()) return false;
 
+  // the work of the propagation is counted as the number of propagated rows
+  // and their nonzeros
+  int64_t work = 0;
+
   size_t changedboundsize = 2 * mipsolver->mipdata_->ARvalue_.size();
 
   for (const auto& cutpoolprop : cutpoolpropagation)
@@ -2398,6 +2431,11 @@ bool HighsDomain::propagate() {
   std::unique_ptr<HighsDomainChange[]> changedbounds(
       new HighsDomainChange[changedboundsize]);
 
+  const HighsInt minParallelNnz =
+      highs::parallel::num_threads() > 1
+          ? mipsolver->options_mip_->mip_min_propagation_nnz_for_parallelism
+          : kHighsIInf;
+
   while (havePropagationRows()) {
     if (objProp_.isActive()) objProp_.propagate();
 
@@ -2407,6 +2445,7 @@ bool HighsDomain::propagate() {
       auto& conflictprop = conflictPoolPropagation[conflictPool];
       while (!conflictprop.propagateConflictInds_.empty()) {
         propagateinds.swap(conflictprop.propagateConflictInds_);
+        work += propagateinds.size();
 
         for (HighsInt conflict : propagateinds)
           conflictprop.propagateConflict(conflict);
@@ -2423,16 +2462,16 @@ bool HighsDomain::propagate() {
       for (HighsInt i = 0; i != numproprows; ++i) {
         HighsInt row = propagateinds[i];
         propagateflags_[row] = 0;
-        propnnz += mipsolver->mipdata_->ARstart_[i + 1] -
-                   mipsolver->mipdata_->ARstart_[i];
+        propnnz += mipsolver->mipdata_->ARstart_[row + 1] -
+                   mipsolver->mipdata_->ARstart_[row];
       }
+      work += numproprows + propnnz;
 
       if (!infeasible_) {
         propRowNumChangedBounds_.assign(
             numproprows, std::make_pair(HighsInt{0}, HighsInt{0}));
 
         auto propagateIndex = [&](HighsInt k) {
-          // for (HighsInt k = 0; k != numproprows; ++k) {
           HighsInt i = propagateinds[k];
           HighsInt start = mipsolver->mipdata_->ARstart_[i];
           HighsInt end = mipsolver->mipdata_->ARstart_[i + 1];
@@ -2475,9 +2514,7 @@ bool HighsDomain::propagate() {
           if (recomputeCapThreshold) recomputeCapacityThreshold(i);
         };
 
-        // printf("numproprows (model): %" HIGHSINT_FORMAT "\n", numproprows);
-
-        for (HighsInt k = 0; k != numproprows; ++k) propagateIndex(k);
+        propagateRows(numproprows, propnnz, minParallelNnz, propagateIndex);
 
         for (HighsInt k = 0; k != numproprows; ++k) {
           HighsInt i = propagateinds[k];
@@ -2520,15 +2557,16 @@ bool HighsDomain::propagate() {
           propnnz += cutpoolprop.cutpool->getMatrix().getRowEnd(cut) -
                      cutpoolprop.cutpool->getMatrix().getRowStart(cut);
         }
+        work += numproprows + propnnz;
 
         if (!infeasible_) {
           propRowNumChangedBounds_.assign(
               numproprows, std::make_pair(HighsInt{0}, HighsInt{0}));
 
           auto propagateIndex = [&](HighsInt k) {
-            // first check if cut is marked as deleted
-            if (cutpoolprop.propagatecutflags_[k] & 2) return;
             HighsInt i = propagateinds[k];
+            // first check if cut is marked as deleted
+            if (cutpoolprop.propagatecutflags_[i] & 2) return;
 
             HighsInt Rlen;
             const HighsInt* Rindex;
@@ -2545,9 +2583,7 @@ bool HighsDomain::propagate() {
             cutpoolprop.recomputeCapacityThreshold(i);
           };
 
-          // printf("numproprows (cuts): %" HIGHSINT_FORMAT "\n", numproprows);
-
-          for (HighsInt k = 0; k != numproprows; ++k) propagateIndex(k);
+          propagateRows(numproprows, propnnz, minParallelNnz, propagateIndex);
 
           for (HighsInt k = 0; k != numproprows; ++k) {
             HighsInt i = propagateinds[k];
@@ -2568,6 +2604,7 @@ bool HighsDomain::propagate() {
     }
   }
 
+  mipsolver->mipdata_->addWork(work);
   return true;
 }
 
@@ -2653,6 +2690,7 @@ void HighsDomain::conflictAnalyzeReconvergence(
   conflictSet.reconvergenceFrontier.insert(
       conflictSet.resolvedDomainChanges.begin(),
       conflictSet.resolvedDomainChanges.end());
+  conflictSet.reconvergenceFrontier.sort();
 
   HighsInt depth = branchPos_.size();
 
@@ -2757,16 +2795,109 @@ HighsDomainChange HighsDomain::flip(const HighsDomainChange& domchg) const {
 
 double HighsDomain::feastol() const { return mipsolver->mipdata_->feastol; }
 
+void HighsDomain::ConflictSet::Frontier::reset(HighsInt stackSize) {
+  for (const LocalDomChg& entry : entries)
+    if (entry.pos != -1) entryIndex[entry.pos] = -1;
+  entries.clear();
+  numSorted = 0;
+  numErased = 0;
+  maxPos = -1;
+  sorted = true;
+  if ((HighsInt)entryIndex.size() < stackSize) entryIndex.resize(stackSize, -1);
+}
+
+void HighsDomain::ConflictSet::Frontier::sort() {
+  if (numErased == 0 && sorted) {
+    numSorted = entries.size();
+    return;
+  }
+
+  if (numErased != 0) {
+    // remove the erased entries while keeping the order of the others
+    HighsInt numEntries = entries.size();
+    HighsInt numKept = 0;
+    HighsInt numSortedKept = 0;
+    for (HighsInt i = 0; i < numEntries; ++i) {
+      if (entries[i].pos == -1) continue;
+      if (i < numSorted) ++numSortedKept;
+      entries[numKept++] = entries[i];
+    }
+    entries.resize(numKept);
+    numSorted = numSortedKept;
+    numErased = 0;
+  }
+
+  if (!sorted) {
+    // only the entries inserted since the last call need to be sorted, they
+    // are then merged with the sorted ones
+    pdqsort(entries.begin() + numSorted, entries.end());
+    if (numSorted != 0) {
+      mergeBuffer.resize(entries.size());
+      std::merge(entries.begin(), entries.begin() + numSorted,
+                 entries.begin() + numSorted, entries.end(),
+                 mergeBuffer.begin());
+      entries.swap(mergeBuffer);
+    }
+    sorted = true;
+  }
+
+  HighsInt numEntries = entries.size();
+  for (HighsInt i = 0; i < numEntries; ++i) entryIndex[entries[i].pos] = i;
+  numSorted = numEntries;
+  maxPos = numEntries == 0 ? -1 : entries.back().pos;
+}
+
+HighsDomain::ConflictSet::Frontier::const_iterator
+HighsDomain::ConflictSet::Frontier::lower_bound(HighsInt pos) const {
+  assert(sorted && numErased == 0);
+  return std::lower_bound(
+      entries.begin(), entries.end(), pos,
+      [](const LocalDomChg& entry, HighsInt pos) { return entry.pos < pos; });
+}
+
+HighsDomain::ConflictSet::Frontier::const_iterator
+HighsDomain::ConflictSet::Frontier::upper_bound(HighsInt pos) const {
+  assert(sorted && numErased == 0);
+  return std::upper_bound(
+      entries.begin(), entries.end(), pos,
+      [](HighsInt pos, const LocalDomChg& entry) { return pos < entry.pos; });
+}
+
+HighsDomain::ConflictSet::Workspace&
+HighsDomain::ConflictSet::acquireWorkspace(std::unique_ptr<Workspace>& own) {
+  static thread_local Workspace threadWorkspace;
+  if (threadWorkspace.inUse) {
+    own = std::unique_ptr<Workspace>(new Workspace());
+    return *own;
+  }
+
+  threadWorkspace.inUse = true;
+  return threadWorkspace;
+}
+
 HighsDomain::ConflictSet::ConflictSet(HighsDomain& localdom_)
     : localdom(localdom_),
       globaldom(localdom.mipsolver->mipdata_->domain),
-      reasonSideFrontier(),
-      reconvergenceFrontier(),
-      resolveQueue(),
-      resolvedDomainChanges() {}
+      ownWorkspace(),
+      workspace(acquireWorkspace(ownWorkspace)),
+      reasonSideFrontier(workspace.reasonSideFrontier),
+      reconvergenceFrontier(workspace.reconvergenceFrontier),
+      resolveQueue(workspace.resolveQueue),
+      resolvedDomainChanges(workspace.resolvedDomainChanges),
+      resolveBuffer(workspace.resolveBuffer) {
+  HighsInt stackSize = localdom.domchgstack_.size();
+  reasonSideFrontier.reset(stackSize);
+  reconvergenceFrontier.reset(stackSize);
+  resolveQueue.clear();
+  resolvedDomainChanges.clear();
+}
+
+HighsDomain::ConflictSet::~ConflictSet() {
+  if (!ownWorkspace) workspace.inUse = false;
+}
 
 bool HighsDomain::ConflictSet::explainBoundChangeGeq(
-    const std::set<LocalDomChg>& currentFrontier, const LocalDomChg& domchg,
+    const Frontier& currentFrontier, const LocalDomChg& domchg,
     const HighsInt* inds, const double* vals, HighsInt len, double rhs,
     double maxAct) {
   if (maxAct == kHighsInf) return false;
@@ -2793,9 +2924,8 @@ bool HighsDomain::ConflictSet::explainBoundChangeGeq(
     if (vals[i] > 0) {
       double ub = localdom.getColUpperPos(col, domchg.pos, cand.boundPos);
       if (globaldom.col_upper_[col] <= ub || cand.boundPos == -1) continue;
-      auto it =
-          currentFrontier.find(LocalDomChg{cand.boundPos, HighsDomainChange()});
-      if (it != currentFrontier.end()) {
+      const LocalDomChg* it = currentFrontier.find(cand.boundPos);
+      if (it != nullptr) {
         cand.baseBound = it->domchg.boundval;
         if (cand.baseBound != globaldom.col_upper_[col])
           M += vals[i] * (cand.baseBound - globaldom.col_upper_[col]);
@@ -2809,10 +2939,9 @@ bool HighsDomain::ConflictSet::explainBoundChangeGeq(
     } else {
       double lb = localdom.getColLowerPos(col, domchg.pos, cand.boundPos);
       if (globaldom.col_lower_[col] >= lb || cand.boundPos == -1) continue;
-      auto it =
-          currentFrontier.find(LocalDomChg{cand.boundPos, HighsDomainChange()});
+      const LocalDomChg* it = currentFrontier.find(cand.boundPos);
 
-      if (it != currentFrontier.end()) {
+      if (it != nullptr) {
         cand.baseBound = it->domchg.boundval;
         if (cand.baseBound != globaldom.col_lower_[col])
           M += vals[i] * (cand.baseBound - globaldom.col_lower_[col]);
@@ -2875,7 +3004,7 @@ bool HighsDomain::ConflictSet::explainBoundChangeGeq(
 }
 
 bool HighsDomain::ConflictSet::explainBoundChangeLeq(
-    const std::set<LocalDomChg>& currentFrontier, const LocalDomChg& domchg,
+    const Frontier& currentFrontier, const LocalDomChg& domchg,
     const HighsInt* inds, const double* vals, HighsInt len, double rhs,
     double minAct) {
   if (minAct == -kHighsInf) return false;
@@ -2901,10 +3030,9 @@ bool HighsDomain::ConflictSet::explainBoundChangeLeq(
     if (vals[i] > 0) {
       double lb = localdom.getColLowerPos(col, domchg.pos, cand.boundPos);
       if (globaldom.col_lower_[col] >= lb || cand.boundPos == -1) continue;
-      auto it =
-          currentFrontier.find(LocalDomChg{cand.boundPos, HighsDomainChange()});
+      const LocalDomChg* it = currentFrontier.find(cand.boundPos);
 
-      if (it != currentFrontier.end()) {
+      if (it != nullptr) {
         cand.baseBound = it->domchg.boundval;
         if (cand.baseBound != globaldom.col_lower_[col])
           M += vals[i] * (cand.baseBound - globaldom.col_lower_[col]);
@@ -2918,9 +3046,8 @@ bool HighsDomain::ConflictSet::explainBoundChangeLeq(
     } else {
       double ub = localdom.getColUpperPos(col, domchg.pos, cand.boundPos);
       if (globaldom.col_upper_[col] <= ub || cand.boundPos == -1) continue;
-      auto it =
-          currentFrontier.find(LocalDomChg{cand.boundPos, HighsDomainChange()});
-      if (it != currentFrontier.end()) {
+      const LocalDomChg* it = currentFrontier.find(cand.boundPos);
+      if (it != nullptr) {
         cand.baseBound = it->domchg.boundval;
         if (cand.baseBound != globaldom.col_upper_[col])
           M += vals[i] * (cand.baseBound - globaldom.col_upper_[col]);
@@ -3469,7 +3596,7 @@ bool HighsDomain::ConflictSet::explainInfeasibilityLeq(const HighsInt* inds,
 }
 
 bool HighsDomain::ConflictSet::explainBoundChange(
-    const std::set<LocalDomChg>& currentFrontier, LocalDomChg domchg) {
+    const Frontier& currentFrontier, LocalDomChg domchg) {
   switch (localdom.domchgreason_[domchg.pos].type) {
     case Reason::kUnknown:
     case Reason::kBranching:
@@ -3660,25 +3787,17 @@ bool HighsDomain::ConflictSet::explainBoundChangeConflict(
   return foundDomchg;
 }
 
-void HighsDomain::ConflictSet::pushQueue(
-    std::set<LocalDomChg>::iterator domchg) {
-  resolveQueue.emplace_back(domchg);
-  std::push_heap(
-      resolveQueue.begin(), resolveQueue.end(),
-      [](const std::set<LocalDomChg>::iterator& a,
-         const std::set<LocalDomChg>::iterator& b) { return a->pos < b->pos; });
+void HighsDomain::ConflictSet::pushQueue(HighsInt domchgPos) {
+  resolveQueue.push_back(domchgPos);
+  std::push_heap(resolveQueue.begin(), resolveQueue.end());
 }
 
-std::set<HighsDomain::ConflictSet::LocalDomChg>::iterator
-HighsDomain::ConflictSet::popQueue() {
+HighsInt HighsDomain::ConflictSet::popQueue() {
   assert(!resolveQueue.empty());
-  std::pop_heap(
-      resolveQueue.begin(), resolveQueue.end(),
-      [](const std::set<LocalDomChg>::iterator& a,
-         const std::set<LocalDomChg>::iterator& b) { return a->pos < b->pos; });
-  std::set<LocalDomChg>::iterator elem = resolveQueue.back();
+  std::pop_heap(resolveQueue.begin(), resolveQueue.end());
+  HighsInt domchgPos = resolveQueue.back();
   resolveQueue.pop_back();
-  return elem;
+  return domchgPos;
 }
 
 void HighsDomain::ConflictSet::clearQueue() { resolveQueue.clear(); }
@@ -3699,15 +3818,15 @@ bool HighsDomain::ConflictSet::resolvable(HighsInt domChgPos) {
   }
 }
 
-HighsInt HighsDomain::ConflictSet::resolveDepth(std::set<LocalDomChg>& frontier,
+HighsInt HighsDomain::ConflictSet::resolveDepth(Frontier& frontier,
                                                 HighsInt depthLevel,
                                                 HighsInt stopSize,
                                                 HighsInt minResolve,
                                                 bool increaseConflictScore) {
   clearQueue();
-  LocalDomChg startPos =
-      LocalDomChg{depthLevel == 0 ? 0 : localdom.branchPos_[depthLevel - 1] + 1,
-                  HighsDomainChange()};
+  frontier.sort();
+  HighsInt startPos =
+      depthLevel == 0 ? 0 : localdom.branchPos_[depthLevel - 1] + 1;
   while (depthLevel < (HighsInt)localdom.branchPos_.size()) {
     HighsInt branchPos = localdom.branchPos_[depthLevel];
     if (localdom.domchgstack_[branchPos].boundval !=
@@ -3720,13 +3839,12 @@ HighsInt HighsDomain::ConflictSet::resolveDepth(std::set<LocalDomChg>& frontier,
   auto iterEnd =
       depthLevel == (HighsInt)localdom.branchPos_.size()
           ? frontier.end()
-          : frontier.upper_bound(LocalDomChg{localdom.branchPos_[depthLevel],
-                                             HighsDomainChange()});
+          : frontier.upper_bound(localdom.branchPos_[depthLevel]);
   bool empty = true;
   for (auto it = frontier.lower_bound(startPos); it != iterEnd; ++it) {
     assert(it != frontier.end());
     empty = false;
-    if (resolvable(it->pos)) pushQueue(it);
+    if (resolvable(it->pos)) pushQueue(it->pos);
   }
 
   if (empty) return -1;
@@ -3735,8 +3853,8 @@ HighsInt HighsDomain::ConflictSet::resolveDepth(std::set<LocalDomChg>& frontier,
 
   while (queueSize() > stopSize ||
          (queueSize() > 0 && numResolved < minResolve)) {
-    std::set<LocalDomChg>::iterator pos = popQueue();
-    if (!explainBoundChange(frontier, *pos)) continue;
+    HighsInt pos = popQueue();
+    if (!explainBoundChange(frontier, *frontier.find(pos))) continue;
 
     ++numResolved;
     frontier.erase(pos);
@@ -3751,8 +3869,7 @@ HighsInt HighsDomain::ConflictSet::resolveDepth(std::set<LocalDomChg>& frontier,
             localdom.mipsolver->mipdata_->pseudocost.increaseConflictScoreDown(
                 localdom.domchgstack_[i.pos].column);
         }
-        if (i.pos >= startPos.pos && resolvable(i.pos))
-          pushQueue(insertResult.first);
+        if (i.pos >= startPos && resolvable(i.pos)) pushQueue(i.pos);
       } else {
         if (i.domchg.boundtype == HighsBoundType::kLower) {
           // if (insertResult.first->domchg.boundval != i.domchg.boundval)
@@ -3778,6 +3895,7 @@ HighsInt HighsDomain::ConflictSet::resolveDepth(std::set<LocalDomChg>& frontier,
     }
   }
 
+  frontier.sort();
   return numResolved;
 }
 
@@ -3800,15 +3918,15 @@ HighsInt HighsDomain::ConflictSet::computeCuts(
   // if the queue size is 1 then we have a resolvable UIP that is not the
   // branch vertex
   if (queueSize() == 1) {
-    LocalDomChg uip = *popQueue();
+    LocalDomChg uip = *reasonSideFrontier.find(popQueue());
     clearQueue();
 
     // compute the UIP reconvergence cut
-    reconvergenceFrontier.clear();
+    reconvergenceFrontier.reset(localdom.domchgstack_.size());
     reconvergenceFrontier.insert(uip);
     HighsInt numResolved = resolveDepth(reconvergenceFrontier, depthLevel, 0);
 
-    if (numResolved > 0 && reconvergenceFrontier.count(uip) == 0) {
+    if (numResolved > 0 && !reconvergenceFrontier.contains(uip.pos)) {
       localdom.mipsolver->mipdata_->debugSolution
           .checkConflictReconvergenceFrontier(reconvergenceFrontier, uip,
                                               localdom.domchgstack_);
@@ -3843,6 +3961,7 @@ void HighsDomain::ConflictSet::conflictAnalysis(
 
   reasonSideFrontier.insert(resolvedDomainChanges.begin(),
                             resolvedDomainChanges.end());
+  reasonSideFrontier.sort();
 
   localdom.mipsolver->mipdata_->debugSolution.checkConflictReasonFrontier(
       reasonSideFrontier, localdom.domchgstack_);
@@ -3917,6 +4036,7 @@ void HighsDomain::ConflictSet::conflictAnalysis(
 
   reasonSideFrontier.insert(resolvedDomainChanges.begin(),
                             resolvedDomainChanges.end());
+  reasonSideFrontier.sort();
 
   assert(resolvedDomainChanges.size() == reasonSideFrontier.size());
 
@@ -11,6 +11,7 @@
 #ifndef HIGHS_DOMAIN_H_
 #define HIGHS_DOMAIN_H_
 
+#include <cassert>
 #include <cstdint>
 #include <deque>
 #include <memory>
@@ -74,7 +75,98 @@ class HighsDomain {
       bool operator<(const LocalDomChg& other) const { return pos < other.pos; }
     };
 
+    /// Set of domain changes with distinct positions in the domain change
+    /// stack. The entries are stored in a flat array together with an index
+    /// from stack positions to entries, so that lookups, insertions and
+    /// removals take constant time. Erased entries are only marked, they are
+    /// removed when the frontier is sorted by position which must be done
+    /// before it is iterated.
+    class Frontier {
+      std::vector<LocalDomChg> entries;
+      std::vector<HighsInt> entryIndex;
+      std::vector<LocalDomChg> mergeBuffer;
+      // the entries before numSorted were ordered by the last call to sort()
+      HighsInt numSorted = 0;
+      HighsInt numErased = 0;
+      HighsInt maxPos = -1;
+      bool sorted = true;
+
+     public:
+      using const_iterator = std::vector<LocalDomChg>::const_iterator;
+
+      /// removes all entries and prepares the index for the given size of
+      /// the domain change stack
+      void reset(HighsInt stackSize);
+
+      std::pair<LocalDomChg*, bool> insert(const LocalDomChg& domchg) {
+        assert(domchg.pos >= 0);
+        if (domchg.pos >= (HighsInt)entryIndex.size())
+          entryIndex.resize(domchg.pos + 1, -1);
+        HighsInt& index = entryIndex[domchg.pos];
+        if (index != -1) return std::make_pair(&entries[index], false);
+
+        index = entries.size();
+        entries.push_back(domchg);
+        if (domchg.pos < maxPos)
+          sorted = false;
+        else
+          maxPos = domchg.pos;
+        return std::make_pair(&entries.back(), true);
+      }
+
+      template <typename Iter>
+      void insert(Iter first, Iter last) {
+        for (; first != last; ++first) insert(*first);
+      }
+
+      LocalDomChg* find(HighsInt pos) {
+        if (pos >= (HighsInt)entryIndex.size() || entryIndex[pos] == -1)
+          return nullptr;
+        return &entries[entryIndex[pos]];
+      }
+
+      const LocalDomChg* find(HighsInt pos) const {
+        if (pos >= (HighsInt)entryIndex.size() || entryIndex[pos] == -1)
+          return nullptr;
+        return &entries[entryIndex[pos]];
+      }
+
+      bool contains(HighsInt pos) const { return find(pos) != nullptr; }
+
+      void erase(HighsInt pos) {
+        LocalDomChg* entry = find(pos);
+        if (entry == nullptr) return;
+        entry->pos = -1;
+        entryIndex[pos] = -1;
+        ++numErased;
+      }
+
+      /// removes the erased entries and orders the remaining ones by position
+      void sort();
+
+      HighsInt size() const { return entries.size() - numErased; }
+
+      bool empty() const { return size() == 0; }
+
+      const_iterator begin() const {
+        assert(sorted && numErased == 0);
+        return entries.begin();
+      }
+
+      const_iterator end() const {
+        assert(sorted && numErased == 0);
+        return entries.end();
+      }
+
+      /// first entry with a position that is not smaller than pos
+      const_iterator lower_bound(HighsInt pos) const;
+
+      /// first entry with a position that is larger than pos
+      const_iterator upper_bound(HighsInt pos) const;
+    };
+
     ConflictSet(HighsDomain& localdom);
+    ~ConflictSet();
 
     void conflictAnalysis(HighsConflictPool& conflictPool);
     void conflictAnalysis(const HighsInt* proofinds, const double* proofvals,
@@ -82,11 +174,6 @@ class HighsDomain {
                           HighsConflictPool& conflictPool);
 
    private:
-    std::set<LocalDomChg> reasonSideFrontier;
-    std::set<LocalDomChg> reconvergenceFrontier;
-    std::vector<std::set<LocalDomChg>::iterator> resolveQueue;
-    std::vector<LocalDomChg> resolvedDomainChanges;
-
     struct ResolveCandidate {
       double delta;
       double baseBound;
@@ -102,15 +189,35 @@ class HighsDomain {
       }
     };
 
-    std::vector<ResolveCandidate> resolveBuffer;
+    /// buffers of a conflict analysis, they are kept per thread so that their
+    /// memory is reused by subsequent analyses
+    struct Workspace {
+      Frontier reasonSideFrontier;
+      Frontier reconvergenceFrontier;
+      std::vector<HighsInt> resolveQueue;
+      std::vector<LocalDomChg> resolvedDomainChanges;
+      std::vector<ResolveCandidate> resolveBuffer;
+      bool inUse = false;
+    };
+
+    // only set if the workspace of the thread is used by another conflict set
+    std::unique_ptr<Workspace> ownWorkspace;
+    Workspace& workspace;
+    Frontier& reasonSideFrontier;
+    Frontier& reconvergenceFrontier;
+    std::vector<HighsInt>& resolveQueue;
+    std::vector<LocalDomChg>& resolvedDomainChanges;
+    std::vector<ResolveCandidate>& resolveBuffer;
+
+    static Workspace& acquireWorkspace(std::unique_ptr<Workspace>& own);
 
-    void pushQueue(std::set<LocalDomChg>::iterator domchgPos);
-    std::set<LocalDomChg>::iterator popQueue();
+    void pushQueue(HighsInt domchgPos);
+    HighsInt popQueue();
     void clearQueue();
     HighsInt queueSize();
     bool resolvable(HighsInt domChgPos);
 
-    HighsInt resolveDepth(std::set<LocalDomChg>& frontier, HighsInt depthLevel,
+    HighsInt resolveDepth(Frontier& frontier, HighsInt depthLevel,
                           HighsInt stopSize, HighsInt minResolve = 0,
                           bool increaseConflictScore = false);
 
@@ -127,7 +234,7 @@ class HighsDomain {
     bool explainInfeasibilityGeq(const HighsInt* inds, const double* vals,
                                  HighsInt len, double rhs, double maxActivity);
 
-    bool explainBoundChange(const std::set<LocalDomChg>& currentFrontier,
+    bool explainBoundChange(const Frontier& currentFrontier,
                             LocalDomChg domchg);
 
     // bool explainBoundChange(HighsInt pos) {
@@ -139,12 +246,12 @@ class HighsDomain {
                                     const HighsDomainChange* conflict,
                                     HighsInt len);
 
-    bool explainBoundChangeLeq(const std::set<LocalDomChg>& currentFrontier,
+    bool explainBoundChangeLeq(const Frontier& currentFrontier,
                                const LocalDomChg& domChg, const HighsInt* inds,
                                const double* vals, HighsInt len, double rhs,
                                double minActivity);
 
-    bool explainBoundChangeGeq(const std::set<LocalDomChg>& currentFrontier,
+    bool explainBoundChangeGeq(const Frontier& currentFrontier,
                                const LocalDomChg& domChg, const HighsInt* inds,
                                const double* vals, HighsInt len, double rhs,
                                double maxActivity);
@@ -15,9 +15,14 @@
 #include <cstddef>
 #include <numeric>
 
-HighsDynamicRowMatrix::HighsDynamicRowMatrix(HighsInt ncols) {
-  AheadPos_.resize(ncols, -1);
-  AheadNeg_.resize(ncols, -1);
+constexpr HighsInt HighsDynamicRowMatrix::kUnlinked;
+
+HighsDynamicRowMatrix::HighsDynamicRowMatrix(HighsInt ncols)
+    : numStaleEntries_(0), numFreeNonzeros_(0) {
+  AcolStart_.resize(ncols + 1, 0);
+  AcolNegStart_.resize(ncols, 0);
+  AnewHeadPos_.resize(ncols, -1);
+  AnewHeadNeg_.resize(ncols, -1);
 }
 /// adds a row to the matrix with the given values and returns its index
 HighsInt HighsDynamicRowMatrix::addRow(HighsInt* Rindex, double* Rvalue,
@@ -36,14 +41,10 @@ HighsInt HighsDynamicRowMatrix::addRow(HighsInt* Rindex, double* Rvalue,
 
     ARindex_.resize(end);
     ARvalue_.resize(end);
-    ARrowindex_.resize(end);
-    AprevPos_.resize(end, -1);
-    AnextPos_.resize(end, -1);
-    AprevNeg_.resize(end, -1);
-    AnextNeg_.resize(end, -1);
   } else {
     std::pair<HighsInt, HighsInt> freeslot = *it;
     freespaces_.erase(it);
+    numFreeNonzeros_ -= Rlen;
 
     start = freeslot.second;
     end = start + Rlen;
@@ -58,91 +59,61 @@ HighsInt HighsDynamicRowMatrix::addRow(HighsInt* Rindex, double* Rvalue,
   if (deletedrows_.empty()) {
     rowindex = ARrange_.size();
     ARrange_.emplace_back(start, end);
-    colsLinked.push_back(linkCols);
+    linkPos_.push_back(kUnlinked);
+    linkOrderPos_.push_back(-1);
   } else {
     rowindex = deletedrows_.back();
     deletedrows_.pop_back();
     ARrange_[rowindex].first = start;
     ARrange_[rowindex].second = end;
-    colsLinked[rowindex] = linkCols;
   }
 
   // now add the nonzeros in the order sorted by the index value
   for (HighsInt i = start; i != end; ++i) {
     ARindex_[i] = Rindex[i - start];
     ARvalue_[i] = Rvalue[i - start];
-    ARrowindex_[i] = rowindex;
   }
 
-  // link the row values to the columns
-  if (!linkCols) return rowindex;
+  // link the row values to the columns, any entries of an earlier row with
+  // the same index come before the new position and are skipped
+  if (!linkCols) {
+    linkPos_[rowindex] = kUnlinked;
+    return rowindex;
+  }
 
+  linkPos_[rowindex] = AnewRow_.size();
+  linkOrderPos_[rowindex] = linkOrder_.size();
+  linkOrder_.push_back(rowindex);
   for (HighsInt i = start; i != end; ++i) {
     HighsInt col = ARindex_[i];
+    HighsInt pos = AnewRow_.size();
+    AnewRow_.push_back(rowindex);
+    AnewValue_.push_back(ARvalue_[i]);
 
     if (ARvalue_[i] > 0) {
-      AprevPos_[i] = -1;
-      HighsInt head = AheadPos_[col];
-      AheadPos_[col] = i;
-      AnextPos_[i] = head;
-
-      if (head != -1) AprevPos_[head] = i;
+      AnewNext_.push_back(AnewHeadPos_[col]);
+      AnewHeadPos_[col] = pos;
     } else {
-      AprevNeg_[i] = -1;
-      HighsInt head = AheadNeg_[col];
-      AheadNeg_[col] = i;
-      AnextNeg_[i] = head;
-
-      if (head != -1) AprevNeg_[head] = i;
+      AnewNext_.push_back(AnewHeadNeg_[col]);
+      AnewHeadNeg_[col] = pos;
     }
   }
 
+  rebuildColumnsIfNeeded();
+
   return rowindex;
 }
 
-void HighsDynamicRowMatrix::unlinkColumns(HighsInt rowindex) {
-  if (!colsLinked[rowindex]) return;
+void HighsDynamicRowMatrix::unlinkRow(HighsInt rowindex) {
+  numStaleEntries_ += ARrange_[rowindex].second - ARrange_[rowindex].first;
+  linkPos_[rowindex] = kUnlinked;
+}
 
-  colsLinked[rowindex] = false;
-  HighsInt start = ARrange_[rowindex].first;
-  HighsInt end = ARrange_[rowindex].second;
-  for (HighsInt i = start; i != end; ++i) {
-    HighsInt col = ARindex_[i];
+void HighsDynamicRowMatrix::unlinkColumns(HighsInt rowindex) {
+  if (!columnsLinked(rowindex)) return;
 
-    if (ARvalue_[i] > 0) {
-      HighsInt prev = AprevPos_[i];
-      HighsInt next = AnextPos_[i];
-
-      if (next != -1) {
-        assert(AprevPos_[next] == i);
-        AprevPos_[next] = prev;
-      }
-
-      if (prev != -1) {
-        assert(AnextPos_[prev] == i);
-        AnextPos_[prev] = next;
-      } else {
-        assert(AheadPos_[col] == i);
-        AheadPos_[col] = next;
-      }
-    } else {
-      HighsInt prev = AprevNeg_[i];
-      HighsInt next = AnextNeg_[i];
-
-      if (next != -1) {
-        assert(AprevNeg_[next] == i);
-        AprevNeg_[next] = prev;
-      }
-
-      if (prev != -1) {
-        assert(AnextNeg_[prev] == i);
-        AnextNeg_[prev] = next;
-      } else {
-        assert(AheadNeg_[col] == i);
-        AheadNeg_[col] = next;
-      }
-    }
-  }
+  unlinkRow(rowindex);
+  rebuildColumnsIfNeeded();
 }
 
 /// removes the row with the given index from the matrix, afterwards the index
@@ -151,52 +122,119 @@ void HighsDynamicRowMatrix::removeRow(HighsInt rowindex) {
   HighsInt start = ARrange_[rowindex].first;
   HighsInt end = ARrange_[rowindex].second;
 
-  if (colsLinked[rowindex]) {
-    for (HighsInt i = start; i != end; ++i) {
-      HighsInt col = ARindex_[i];
-
-      if (ARvalue_[i] > 0) {
-        HighsInt prev = AprevPos_[i];
-        HighsInt next = AnextPos_[i];
-
-        if (next != -1) {
-          assert(AprevPos_[next] == i);
-          AprevPos_[next] = prev;
-        }
-
-        if (prev != -1) {
-          assert(AnextPos_[prev] == i);
-          AnextPos_[prev] = next;
-        } else {
-          assert(AheadPos_[col] == i);
-          AheadPos_[col] = next;
-        }
-      } else {
-        HighsInt prev = AprevNeg_[i];
-        HighsInt next = AnextNeg_[i];
-
-        if (next != -1) {
-          assert(AprevNeg_[next] == i);
-          AprevNeg_[next] = prev;
-        }
-
-        if (prev != -1) {
-          assert(AnextNeg_[prev] == i);
-          AnextNeg_[prev] = next;
-        } else {
-          assert(AheadNeg_[col] == i);
-          AheadNeg_[col] = next;
-        }
-      }
-    }
-  }
+  if (columnsLinked(rowindex)) unlinkRow(rowindex);
 
   // register the space of the deleted row and the index so that it can be
   // reused
   deletedrows_.push_back(rowindex);
   freespaces_.emplace(end - start, start);
+  numFreeNonzeros_ += end - start;
 
   // set the range to -1,-1 to indicate a deleted row
   ARrange_[rowindex].first = -1;
   ARrange_[rowindex].second = -1;
+
+  rebuildColumnsIfNeeded();
+}
+
+void HighsDynamicRowMatrix::rebuildColumnsIfNeeded() {
+  // a rebuild costs time linear in the number of columns and linked entries,
+  // which is amortised over the changes since the last rebuild
+  HighsInt numCol = AcolNegStart_.size();
+  HighsInt numEntries = AcolRow_.size() + AnewRow_.size();
+  HighsInt numChanges = AnewRow_.size() + numStaleEntries_;
+  if (2 * numChanges > std::max(numCol, numEntries - numStaleEntries_))
+    rebuildColumns();
+}
+
+void HighsDynamicRowMatrix::rebuildColumns() {
+  HighsInt numCol = AcolNegStart_.size();
+
+  // drop the rows that are no longer linked from the link order
+  HighsInt numLinked = 0;
+  for (size_t k = 0; k != linkOrder_.size(); ++k) {
+    HighsInt row = linkOrder_[k];
+    if (!columnsLinked(row) || linkOrderPos_[row] != (HighsInt)k) continue;
+    linkOrderPos_[row] = numLinked;
+    linkOrder_[numLinked++] = row;
+  }
+  linkOrder_.resize(numLinked);
+
+  // count the positive and negative entries of each column and determine the
+  // start of their blocks
+  std::vector<HighsInt> posFill(numCol, 0);
+  std::vector<HighsInt> negFill(numCol, 0);
+  for (HighsInt row : linkOrder_) {
+    for (HighsInt i = ARrange_[row].first; i != ARrange_[row].second; ++i) {
+      if (ARvalue_[i] > 0)
+        ++posFill[ARindex_[i]];
+      else
+        ++negFill[ARindex_[i]];
+    }
+  }
+
+  AcolStart_[0] = 0;
+  for (HighsInt col = 0; col != numCol; ++col) {
+    AcolNegStart_[col] = AcolStart_[col] + posFill[col];
+    AcolStart_[col + 1] = AcolNegStart_[col] + negFill[col];
+    posFill[col] = AcolStart_[col];
+    negFill[col] = AcolNegStart_[col];
+  }
+
+  // fill the blocks with the most recently linked rows first, which is the
+  // order in which the lists of newly linked rows are traversed
+  AcolRow_.resize(AcolStart_[numCol]);
+  AcolValue_.resize(AcolStart_[numCol]);
+  for (HighsInt k = numLinked - 1; k >= 0; --k) {
+    HighsInt row = linkOrder_[k];
+    for (HighsInt i = ARrange_[row].first; i != ARrange_[row].second; ++i) {
+      HighsInt pos = ARvalue_[i] > 0 ? posFill[ARindex_[i]]++
+                                     : negFill[ARindex_[i]]++;
+      AcolRow_[pos] = row;
+      AcolValue_[pos] = ARvalue_[i];
+    }
+    linkPos_[row] = -1;
+  }
+
+  AnewRow_.clear();
+  AnewValue_.clear();
+  AnewNext_.clear();
+  std::fill(AnewHeadPos_.begin(), AnewHeadPos_.end(), -1);
+  std::fill(AnewHeadNeg_.begin(), AnewHeadNeg_.end(), -1);
+  numStaleEntries_ = 0;
+}
+
+void HighsDynamicRowMatrix::compact() {
+  if (2 * numFreeNonzeros_ <= (HighsInt)ARindex_.size()) return;
+
+  // move the rows in the order of their position so that each row is only
+  // moved towards the front
+  std::vector<std::pair<HighsInt, HighsInt>> rowStarts;
+  rowStarts.reserve(ARrange_.size() - deletedrows_.size());
+  for (HighsInt row = 0; row != (HighsInt)ARrange_.size(); ++row) {
+    if (ARrange_[row].first != -1)
+      rowStarts.emplace_back(ARrange_[row].first, row);
+  }
+  std::sort(rowStarts.begin(), rowStarts.end());
+
+  HighsInt pos = 0;
+  for (const std::pair<HighsInt, HighsInt>& rowStart : rowStarts) {
+    HighsInt row = rowStart.second;
+    HighsInt start = ARrange_[row].first;
+    HighsInt end = ARrange_[row].second;
+    if (start != pos) {
+      std::copy(ARindex_.begin() + start, ARindex_.begin() + end,
+                ARindex_.begin() + pos);
+      std::copy(ARvalue_.begin() + start, ARvalue_.begin() + end,
+                ARvalue_.begin() + pos);
+      ARrange_[row].first = pos;
+    }
+    pos += end - start;
+    ARrange_[row].second = pos;
+  }
+
+  ARindex_.resize(pos);
+  ARvalue_.resize(pos);
+  freespaces_.clear();
+  numFreeNonzeros_ = 0;
 }
@@ -11,6 +11,7 @@
 #ifndef HIGHS_DYNAMIC_ROW_MATRIX_H_
 #define HIGHS_DYNAMIC_ROW_MATRIX_H_
 
+#include <cstdint>
 #include <set>
 #include <utility>
 #include <vector>
@@ -19,6 +20,9 @@
 
 class HighsDynamicRowMatrix {
  private:
+  /// value of linkPos_ for a row whose columns are not linked
+  static constexpr HighsInt kUnlinked = -2;
+
   /// vector of index ranges in the index and value arrays of AR for each row
   std::vector<std::pair<HighsInt, HighsInt>> ARrange_;
 
@@ -27,32 +31,62 @@ class HighsDynamicRowMatrix {
   /// values for each nonzero in AR
   std::vector<double> ARvalue_;
 
-  std::vector<HighsInt> ARrowindex_;
-  std::vector<HighsInt> AnextPos_;
-  std::vector<HighsInt> AprevPos_;
-  std::vector<HighsInt> AnextNeg_;
-  std::vector<HighsInt> AprevNeg_;
-
-  /// vector of pointers to the head/tail of the nonzero block list for each
-  /// column
-  std::vector<HighsInt> AheadPos_;
-  std::vector<HighsInt> AheadNeg_;
-
-  std::vector<uint8_t> colsLinked;
-
-  /// vector of column sizes
+  /// column blocks of the rows whose columns were linked when the blocks were
+  /// last rebuilt: the positive entries of column j are stored in positions
+  /// AcolStart_[j] to AcolNegStart_[j] and the negative ones from there to
+  /// AcolStart_[j + 1], each in the order of decreasing link time
+  std::vector<HighsInt> AcolStart_;
+  std::vector<HighsInt> AcolNegStart_;
+  std::vector<HighsInt> AcolRow_;
+  std::vector<double> AcolValue_;
+
+  /// entries of the rows linked since the last rebuild in singly linked lists
+  /// for each column, with the most recently linked row first
+  std::vector<HighsInt> AnewRow_;
+  std::vector<double> AnewValue_;
+  std::vector<HighsInt> AnewNext_;
+  std::vector<HighsInt> AnewHeadPos_;
+  std::vector<HighsInt> AnewHeadNeg_;
+
+  /// for each row the position of its first entry in the lists of the newly
+  /// linked rows, -1 if its entries are in the column blocks, and kUnlinked if
+  /// its columns are not linked. Entries of rows that were unlinked or deleted
+  /// are skipped by checking this position, and removed on the next rebuild.
+  std::vector<HighsInt> linkPos_;
+
+  /// rows in the order in which their columns were linked, which may contain
+  /// rows that were unlinked since or whose index was reused, together with
+  /// the position of each row in this vector
+  std::vector<HighsInt> linkOrder_;
+  std::vector<HighsInt> linkOrderPos_;
+
+  /// number of entries in the column blocks and lists of unlinked rows
+  HighsInt numStaleEntries_;
 
   /// keep an ordered set ofof free spaces in the row arrays so that they can be
   /// reused efficiently
   std::set<std::pair<HighsInt, HighsInt>> freespaces_;
 
+  /// number of nonzeros in the free spaces
+  HighsInt numFreeNonzeros_;
+
   /// vector of deleted rows so that their indices can be reused
   std::vector<HighsInt> deletedrows_;
 
+  void unlinkRow(HighsInt rowindex);
+
+  /// rebuilds the column blocks from all linked rows if the entries of newly
+  /// linked and unlinked rows make up a large part of the column access
+  void rebuildColumnsIfNeeded();
+
+  void rebuildColumns();
+
  public:
   HighsDynamicRowMatrix(HighsInt ncols);
 
-  bool columnsLinked(HighsInt rowindex) const { return colsLinked[rowindex]; }
+  bool columnsLinked(HighsInt rowindex) const {
+    return linkPos_[rowindex] != kUnlinked;
+  }
 
   void unlinkColumns(HighsInt rowindex);
 
@@ -64,6 +98,11 @@ class HighsDynamicRowMatrix {
   /// can be reused for new rows
   void removeRow(HighsInt rowindex);
 
+  /// moves the rows to the front of the index and value arrays if more than
+  /// half of their capacity is free space. The row indices remain valid but
+  /// the ranges of the rows change.
+  void compact();
+
   std::size_t nonzeroCapacity() const { return ARvalue_.size(); }
 
   /// calls the given function object for each entry in the given column.
@@ -71,21 +110,34 @@ class HighsDynamicRowMatrix {
   /// the nonzero value of the column in that row as the second argument.
   template <typename Func>
   void forEachPositiveColumnEntry(HighsInt col, Func&& f) const {
-    HighsInt iter = AheadPos_[col];
+    for (HighsInt iter = AnewHeadPos_[col]; iter != -1;
+         iter = AnewNext_[iter]) {
+      HighsInt row = AnewRow_[iter];
+      if (iter < linkPos_[row] || linkPos_[row] < 0) continue;
+      if (!f(row, AnewValue_[iter])) return;
+    }
 
-    while (iter != -1) {
-      if (!f(ARrowindex_[iter], ARvalue_[iter])) break;
-      iter = AnextPos_[iter];
+    for (HighsInt iter = AcolStart_[col]; iter != AcolNegStart_[col]; ++iter) {
+      HighsInt row = AcolRow_[iter];
+      if (linkPos_[row] != -1) continue;
+      if (!f(row, AcolValue_[iter])) return;
     }
   }
 
   template <typename Func>
   void forEachNegativeColumnEntry(HighsInt col, Func&& f) const {
-    HighsInt iter = AheadNeg_[col];
+    for (HighsInt iter = AnewHeadNeg_[col]; iter != -1;
+         iter = AnewNext_[iter]) {
+      HighsInt row = AnewRow_[iter];
+      if (iter < linkPos_[row] || linkPos_[row] < 0) continue;
+      if (!f(row, AnewValue_[iter])) return;
+    }
 
-    while (iter != -1) {
-      if (!f(ARrowindex_[iter], ARvalue_[iter])) break;
-      iter = AnextNeg_[iter];
+    for (HighsInt iter = AcolNegStart_[col]; iter != AcolStart_[col + 1];
+         ++iter) {
+      HighsInt row = AcolRow_[iter];
+      if (linkPos_[row] != -1) continue;
+      if (!f(row, AcolValue_[iter])) return;
     }
   }
 
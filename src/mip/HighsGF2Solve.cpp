@@ -0,0 +1,72 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsGF2Solve.h"
+
+#include <algorithm>
+#include <numeric>
+
+bool HighsGF2Solve::factor() {
+  // as in HighsGFkSolve columns with few nonzeros are pivoted first, which
+  // tends to give solutions with a small support
+  std::vector<HighsInt> colOrder(numCol);
+  std::iota(colOrder.begin(), colOrder.end(), 0);
+  std::stable_sort(colOrder.begin(), colOrder.end(),
+                   [&](HighsInt a, HighsInt b) {
+                     return colsize[a] < colsize[b];
+                   });
+
+  HighsInt maxPivot = std::min(numRow, numCol);
+  factorColPerm.clear();
+  factorRowPerm.clear();
+  factorColPerm.reserve(maxPivot);
+  factorRowPerm.reserve(maxPivot);
+  colIsBasic.assign(numCol, 0);
+  std::vector<uint8_t> rowUsed(numRow);
+
+  for (HighsInt pivotCol : colOrder) {
+    if (colsize[pivotCol] == 0) continue;
+
+    HighsInt pivotRow = -1;
+    for (HighsInt i = 0; i != numRow; ++i) {
+      if (!rowUsed[i] && testBit(row(i), pivotCol)) {
+        pivotRow = i;
+        break;
+      }
+    }
+    if (pivotRow == -1) continue;
+
+    // eliminate the pivot column from all other rows, including the ones
+    // that were already used as pivot rows, so that the result is in reduced
+    // row echelon form. The rows are combined word by word in a loop that the
+    // compiler can vectorize.
+    const uint64_t* pivotBits = row(pivotRow);
+    for (HighsInt i = 0; i != numRow; ++i) {
+      if (i == pivotRow) continue;
+      uint64_t* bits = row(i);
+      if (!testBit(bits, pivotCol)) continue;
+      for (HighsInt w = 0; w != numWords; ++w) bits[w] ^= pivotBits[w];
+      rhs[i] ^= rhs[pivotRow];
+    }
+
+    factorColPerm.push_back(pivotCol);
+    factorRowPerm.push_back(pivotRow);
+    colIsBasic[pivotCol] = 1;
+    rowUsed[pivotRow] = 1;
+    if ((HighsInt)factorColPerm.size() == maxPivot) break;
+  }
+
+  // the rows that were not used as pivot rows are zero now, so a solution
+  // exists if and only if their right hand sides are zero
+  for (HighsInt i = 0; i != numRow; ++i)
+    if (!rowUsed[i] && rhs[i] != 0) return false;
+
+  return true;
+}
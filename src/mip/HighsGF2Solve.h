@@ -0,0 +1,137 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsGF2Solve.h
+ * @brief Gaussian elimination over GF(2) on bit-packed rows
+ */
+
+#ifndef HIGHS_GF2_SOLVE_H_
+#define HIGHS_GF2_SOLVE_H_
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "mip/HighsGFkSolve.h"
+
+/// Solver for linear systems over GF(2) with the same interface as
+/// HighsGFkSolve for k = 2. Each row of the system is stored as a dense
+/// sequence of 64 bit words, so that eliminating a nonzero is an exclusive or
+/// of two word arrays. This is only efficient when the system fits into a
+/// modest amount of memory, which can be checked with fitsDense().
+class HighsGF2Solve {
+  HighsInt numCol;
+  HighsInt numRow;
+  HighsInt numWords;
+
+  // bit-packed rows of the system and their right hand sides
+  std::vector<uint64_t> rowBits;
+  std::vector<uint8_t> rhs;
+  std::vector<HighsInt> colsize;
+
+  // pivots of the reduced row echelon form
+  std::vector<HighsInt> factorColPerm;
+  std::vector<HighsInt> factorRowPerm;
+  std::vector<uint8_t> colIsBasic;
+
+  uint64_t* row(HighsInt i) { return rowBits.data() + size_t(i) * numWords; }
+
+  const uint64_t* row(HighsInt i) const {
+    return rowBits.data() + size_t(i) * numWords;
+  }
+
+  static bool testBit(const uint64_t* bits, HighsInt col) {
+    return (bits[col >> 6] >> (col & 63)) & 1;
+  }
+
+  static void setBit(uint64_t* bits, HighsInt col) {
+    bits[col >> 6] |= uint64_t{1} << (col & 63);
+  }
+
+  /// transforms the system into reduced row echelon form and returns whether
+  /// it has a solution
+  bool factor();
+
+ public:
+  using SolutionEntry = HighsGFkSolve::SolutionEntry;
+
+  /// maximal number of words for the bit-packed system
+  static constexpr size_t kMaxDenseWords = size_t{1} << 20;
+
+  static bool fitsDense(HighsInt numRow, HighsInt numCol) {
+    return size_t(numRow) * size_t((numCol + 63) >> 6) <= kMaxDenseWords;
+  }
+
+  bool getEntry(HighsInt i, HighsInt col) const {
+    return testBit(row(i), col);
+  }
+
+  template <typename T>
+  void fromCSC(const std::vector<T>& Aval, const std::vector<HighsInt>& Aindex,
+               const std::vector<HighsInt>& Astart, HighsInt numRow) {
+    numCol = Astart.size() - 1;
+    this->numRow = numRow;
+    numWords = (numCol + 63) >> 6;
+
+    rowBits.assign(size_t(numRow) * numWords, 0);
+    rhs.assign(numRow, 0);
+    colsize.assign(numCol, 0);
+
+    for (HighsInt i = 0; i != numCol; ++i) {
+      for (HighsInt j = Astart[i]; j != Astart[i + 1]; ++j) {
+        assert(Aval[j] == (int64_t)Aval[j]);
+        if (((int64_t)Aval[j]) % 2 == 0) continue;
+        setBit(row(Aindex[j]), i);
+        ++colsize[i];
+      }
+    }
+  }
+
+  template <typename T>
+  void setRhs(HighsInt row, T val) {
+    rhs[row] = ((int64_t)val) % 2 != 0;
+  }
+
+  /// reports a basic solution and one additional solution for each nonbasic
+  /// column that occurs in the reduced system. The additional solutions are
+  /// obtained by setting the nonbasic column to one.
+  template <typename ReportSolution>
+  void solve(ReportSolution&& reportSolution) {
+    if (!factor()) return;
+
+    HighsInt numPivot = factorColPerm.size();
+    std::vector<SolutionEntry> solution;
+    solution.reserve(numPivot + 1);
+    for (HighsInt i = 0; i != numPivot; ++i)
+      if (rhs[factorRowPerm[i]]) solution.push_back({factorColPerm[i], 1});
+    reportSolution(solution, 0);
+
+    for (HighsInt col = 0; col != numCol; ++col) {
+      if (colIsBasic[col]) continue;
+
+      solution.clear();
+      bool occurs = false;
+      for (HighsInt i = 0; i != numPivot; ++i) {
+        HighsInt pivotRow = factorRowPerm[i];
+        bool entry = getEntry(pivotRow, col);
+        occurs = occurs || entry;
+        if (rhs[pivotRow] != entry) solution.push_back({factorColPerm[i], 1});
+      }
+      // columns without an entry in the reduced system only add rows with
+      // even coefficients to the basic solution
+      if (!occurs) continue;
+
+      solution.push_back({col, 1});
+      reportSolution(solution, 0);
+    }
+  }
+};
+
+#endif
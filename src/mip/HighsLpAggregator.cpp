@@ -12,6 +12,7 @@
 #include "mip/HighsLpAggregator.h"
 
 #include "mip/HighsLpRelaxation.h"
+#include "mip/HighsMipSolverData.h"
 
 HighsLpAggregator::HighsLpAggregator(const HighsLpRelaxation& lprelaxation)
     : lprelaxation(lprelaxation) {
@@ -24,6 +25,7 @@ void HighsLpAggregator::addRow(HighsInt row, double weight) {
   const double* vals;
   const HighsInt* inds;
   lprelaxation.getRow(row, len, inds, vals);
+  lprelaxation.getMipSolver().mipdata_->addWork(len);
 
   for (HighsInt i = 0; i != len; ++i) vectorsum.add(inds[i], weight * vals[i]);
 
@@ -985,11 +985,12 @@ HighsLpRelaxation::Status HighsLpRelaxation::run(bool resolve_on_error) {
       "time_limit", lpsolver.getRunTime() + mipsolver.options_mip_->time_limit -
                         mipsolver.timer_.read(mipsolver.timer_.solve_clock));
   // lpsolver.setOptionValue("output_flag", true);
-  HighsStatus callstatus = lpsolver.run();
+  HighsStatus callstatus = lpsolver.resolveLp();
 
   const HighsInfo& info = lpsolver.getInfo();
   HighsInt itercount = std::max(HighsInt{0}, info.simplex_iteration_count);
   numlpiters += itercount;
+  mipsolver.mipdata_->addWork(std::max(int64_t{0}, info.work_count));
 
   if (callstatus == HighsStatus::kError) {
     lpsolver.clearSolver();
@@ -0,0 +1,523 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsMipCheckpoint.h"
+
+#include <array>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+
+#include "mip/HighsMipSolverData.h"
+#include "util/HighsHash.h"
+
+namespace {
+
+// identifies checkpoint files, it is written at the start and at the end of
+// the file so that truncated files are detected
+constexpr char kCheckpointMagic[8] = {'H', 'i', 'G', 'H', 'S', 'M', 'I', 'P'};
+
+struct FileClose {
+  void operator()(std::FILE* file) const { std::fclose(file); }
+};
+
+struct CheckpointWriter {
+  std::FILE* file;
+  bool ok;
+
+  template <typename T>
+  void value(const T& val) {
+    ok = ok && std::fwrite(&val, sizeof(T), 1, file) == 1;
+  }
+
+  template <typename T>
+  void array(const T* vals, HighsInt len) {
+    value(len);
+    ok = ok && std::fwrite(vals, sizeof(T), len, file) == size_t(len);
+  }
+
+  template <typename T>
+  void vector(const std::vector<T>& vec) {
+    array(vec.data(), HighsInt(vec.size()));
+  }
+};
+
+struct CheckpointReader {
+  std::FILE* file;
+  bool ok;
+
+  template <typename T>
+  void value(T& val) {
+    ok = ok && std::fread(&val, sizeof(T), 1, file) == 1;
+  }
+
+  template <typename T>
+  void vector(std::vector<T>& vec) {
+    HighsInt len = -1;
+    value(len);
+    ok = ok && len >= 0;
+    if (!ok) return;
+    vec.resize(len);
+    ok = std::fread(vec.data(), sizeof(T), len, file) == size_t(len);
+  }
+};
+
+template <typename T>
+uint64_t hashVector(const std::vector<T>& vec) {
+  return HighsHashHelpers::vector_hash(vec.data(), vec.size());
+}
+
+bool validDomainChanges(const std::vector<HighsDomainChange>& domchgs,
+                        HighsInt numCol) {
+  for (const HighsDomainChange& domchg : domchgs)
+    if (domchg.column < 0 || domchg.column >= numCol) return false;
+
+  return true;
+}
+
+}  // namespace
+
+constexpr uint32_t HighsMipCheckpoint::kVersion;
+
+HighsMipCheckpoint::HighsMipCheckpoint(HighsMipSolver& mipsolver)
+    : mipsolver(mipsolver),
+      lastWriteTime(mipsolver.timer_.read(mipsolver.timer_.solve_clock)) {}
+
+uint64_t HighsMipCheckpoint::modelHash(const HighsLp& model) {
+  const HighsSparseMatrix& matrix = model.a_matrix_;
+  std::array<uint64_t, 14> hashes = {
+      {uint64_t(model.num_col_), uint64_t(model.num_row_),
+       uint64_t(model.sense_), HighsHashHelpers::hash(model.offset_),
+       hashVector(model.col_cost_), hashVector(model.col_lower_),
+       hashVector(model.col_upper_), hashVector(model.row_lower_),
+       hashVector(model.row_upper_), uint64_t(matrix.format_),
+       hashVector(matrix.start_), hashVector(matrix.index_),
+       hashVector(matrix.value_), hashVector(model.integrality_)}};
+
+  return HighsHashHelpers::vector_hash(hashes.data(), hashes.size());
+}
+
+bool HighsMipCheckpoint::due() const {
+  const HighsOptions& options = *mipsolver.options_mip_;
+  if (mipsolver.submip || options.mip_checkpoint_file.empty() ||
+      options.mip_checkpoint_interval == kHighsInf)
+    return false;
+
+  return mipsolver.timer_.read(mipsolver.timer_.solve_clock) - lastWriteTime >=
+         options.mip_checkpoint_interval;
+}
+
+void HighsMipCheckpoint::write() {
+  const HighsOptions& options = *mipsolver.options_mip_;
+  const std::string& filename = options.mip_checkpoint_file;
+  if (mipsolver.submip || filename.empty()) return;
+
+  lastWriteTime = mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+
+  // the checkpoint is written to a temporary file first, so that an existing
+  // checkpoint is only replaced by a complete one
+  std::string tmpname = filename + ".tmp";
+  std::unique_ptr<std::FILE, FileClose> file(std::fopen(tmpname.c_str(), "wb"));
+  if (!file) {
+    highsLogUser(options.log_options, HighsLogType::kWarning,
+                 "Unable to open checkpoint file %s for writing\n",
+                 tmpname.c_str());
+    return;
+  }
+
+  HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+  CheckpointWriter out{file.get(), true};
+
+  out.value(kCheckpointMagic);
+  out.value(kVersion);
+  out.value(uint32_t{sizeof(HighsInt)});
+  out.value(modelHash(*mipsolver.orig_model_));
+  out.value(modelHash(*mipsolver.model_));
+
+  // the incumbent is kept in the original space
+  out.value(mipsolver.solution_objective_);
+  if (mipsolver.solution_objective_ != kHighsInf)
+    out.vector(mipsolver.solution_);
+  else
+    out.vector(std::vector<double>());
+
+  out.vector(mipdata.domain.col_lower_);
+  out.vector(mipdata.domain.col_upper_);
+
+  out.value(mipdata.num_nodes);
+  out.value(mipdata.num_leaves);
+  out.value(double(mipdata.pruned_treeweight));
+  out.value(mipdata.total_lp_iterations);
+  out.value(mipdata.heuristic_lp_iterations);
+  out.value(mipdata.sepa_lp_iterations);
+  out.value(mipdata.sb_lp_iterations);
+
+  out.value(uint8_t{mipdata.firstrootbasis.valid});
+  out.vector(mipdata.firstrootbasis.col_status);
+  out.vector(mipdata.firstrootbasis.row_status);
+
+  const HighsPseudocost& pscost = mipdata.pseudocost;
+  out.vector(pscost.pseudocostup);
+  out.vector(pscost.pseudocostdown);
+  out.vector(pscost.nsamplesup);
+  out.vector(pscost.nsamplesdown);
+  out.vector(pscost.inferencesup);
+  out.vector(pscost.inferencesdown);
+  out.vector(pscost.ninferencesup);
+  out.vector(pscost.ninferencesdown);
+  out.vector(pscost.ncutoffsup);
+  out.vector(pscost.ncutoffsdown);
+  out.vector(pscost.conflictscoreup);
+  out.vector(pscost.conflictscoredown);
+  out.value(pscost.conflict_weight);
+  out.value(pscost.conflict_avg_score);
+  out.value(pscost.cost_total);
+  out.value(pscost.inferences_total);
+  out.value(pscost.nsamplestotal);
+  out.value(pscost.ninferencestotal);
+  out.value(pscost.ncutoffstotal);
+
+  const HighsCutPool& cutpool = mipdata.cutpool;
+  HighsInt numCutRows = cutpool.getMatrix().getNumRows();
+  out.value(cutpool.getNumCuts());
+  for (HighsInt cut = 0; cut != numCutRows; ++cut) {
+    // deleted cuts have a start of -1
+    if (cutpool.getMatrix().getRowStart(cut) == -1) continue;
+    HighsInt cutlen;
+    const HighsInt* cutinds;
+    const double* cutvals;
+    cutpool.getCut(cut, cutlen, cutinds, cutvals);
+    out.array(cutinds, cutlen);
+    out.array(cutvals, cutlen);
+    out.value(cutpool.getRhs()[cut]);
+    out.value(uint8_t{cutpool.cutIsIntegral(cut)});
+  }
+
+  const HighsConflictPool& conflictPool = mipdata.conflictPool;
+  const std::vector<HighsDomainChange>& conflictEntries =
+      conflictPool.getConflictEntryVector();
+  out.value(conflictPool.getNumConflicts());
+  for (const std::pair<HighsInt, HighsInt>& range :
+       conflictPool.getConflictRanges()) {
+    // deleted conflicts have a range of -1,-1
+    if (range.first == -1) continue;
+    out.array(conflictEntries.data() + range.first, range.second - range.first);
+  }
+
+  int64_t numOpenNodes = mipdata.nodequeue.numNodes();
+  out.value(numOpenNodes);
+  mipdata.nodequeue.forEachOpenNode(
+      [&](const HighsNodeQueue::OpenNode& node) {
+        out.value(node.lower_bound);
+        out.value(node.estimate);
+        out.value(node.depth);
+        out.vector(node.domchgstack);
+        out.vector(node.branchings);
+      });
+
+  out.value(kCheckpointMagic);
+
+  bool ok = std::fclose(file.release()) == 0 && out.ok;
+  // std::rename does not replace an existing file on all platforms, in which
+  // case the old checkpoint is removed first
+  if (ok && std::rename(tmpname.c_str(), filename.c_str()) != 0) {
+    std::remove(filename.c_str());
+    ok = std::rename(tmpname.c_str(), filename.c_str()) == 0;
+  }
+
+  if (!ok) {
+    std::remove(tmpname.c_str());
+    highsLogUser(options.log_options, HighsLogType::kWarning,
+                 "Unable to write checkpoint file %s\n", filename.c_str());
+    return;
+  }
+
+  highsLogDev(options.log_options, HighsLogType::kInfo,
+              "wrote checkpoint with %" PRId64 " open nodes to %s\n",
+              numOpenNodes, filename.c_str());
+}
+
+bool HighsMipCheckpoint::resume() {
+  const HighsOptions& options = *mipsolver.options_mip_;
+  const std::string& filename = options.mip_resume_file;
+  if (mipsolver.submip || filename.empty()) return false;
+
+  std::unique_ptr<std::FILE, FileClose> file(std::fopen(filename.c_str(), "rb"));
+  if (!file) {
+    highsLogUser(options.log_options, HighsLogType::kWarning,
+                 "Unable to open checkpoint file %s, the search is not "
+                 "resumed\n",
+                 filename.c_str());
+    return false;
+  }
+
+  CheckpointReader in{file.get(), true};
+
+  char magic[sizeof(kCheckpointMagic)];
+  uint32_t version;
+  uint32_t intSize;
+  uint64_t origModelHash;
+  uint64_t presolvedModelHash;
+  in.value(magic);
+  in.value(version);
+  in.value(intSize);
+  in.value(origModelHash);
+  in.value(presolvedModelHash);
+  if (!in.ok ||
+      std::memcmp(magic, kCheckpointMagic, sizeof(kCheckpointMagic)) != 0 ||
+      version != kVersion || intSize != sizeof(HighsInt)) {
+    highsLogUser(options.log_options, HighsLogType::kWarning,
+                 "%s is not a checkpoint file of this version of HiGHS, the "
+                 "search is not resumed\n",
+                 filename.c_str());
+    return false;
+  }
+
+  if (origModelHash != modelHash(*mipsolver.orig_model_)) {
+    highsLogUser(options.log_options, HighsLogType::kWarning,
+                 "Checkpoint file %s was written for a different model, the "
+                 "search is not resumed\n",
+                 filename.c_str());
+    return false;
+  }
+
+  HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+
+  double solobj;
+  std::vector<double> solution;
+  in.value(solobj);
+  in.vector(solution);
+  if (in.ok && solobj != kHighsInf &&
+      (HighsInt)solution.size() == mipsolver.orig_model_->num_col_)
+    mipdata.trySolution(
+        mipdata.postSolveStack.getReducedPrimalSolution(solution), 'C');
+
+  // the remaining data refers to the presolved model, which is only the same
+  // if presolve and the restarts at the root node gave the same result
+  if (presolvedModelHash != modelHash(*mipsolver.model_)) {
+    highsLogUser(options.log_options, HighsLogType::kInfo,
+                 "The presolved model differs from the one in checkpoint file "
+                 "%s, only the incumbent is restored\n",
+                 filename.c_str());
+    return false;
+  }
+
+  const HighsInt numCol = mipsolver.numCol();
+
+  std::vector<double> colLower;
+  std::vector<double> colUpper;
+  in.vector(colLower);
+  in.vector(colUpper);
+
+  int64_t numNodes;
+  int64_t numLeaves;
+  double prunedTreeweight;
+  int64_t totalLpIterations;
+  int64_t heuristicLpIterations;
+  int64_t sepaLpIterations;
+  int64_t sbLpIterations;
+  in.value(numNodes);
+  in.value(numLeaves);
+  in.value(prunedTreeweight);
+  in.value(totalLpIterations);
+  in.value(heuristicLpIterations);
+  in.value(sepaLpIterations);
+  in.value(sbLpIterations);
+
+  uint8_t basisValid;
+  HighsBasis rootBasis;
+  in.value(basisValid);
+  in.vector(rootBasis.col_status);
+  in.vector(rootBasis.row_status);
+
+  HighsPseudocost pscost = mipdata.pseudocost;
+  in.vector(pscost.pseudocostup);
+  in.vector(pscost.pseudocostdown);
+  in.vector(pscost.nsamplesup);
+  in.vector(pscost.nsamplesdown);
+  in.vector(pscost.inferencesup);
+  in.vector(pscost.inferencesdown);
+  in.vector(pscost.ninferencesup);
+  in.vector(pscost.ninferencesdown);
+  in.vector(pscost.ncutoffsup);
+  in.vector(pscost.ncutoffsdown);
+  in.vector(pscost.conflictscoreup);
+  in.vector(pscost.conflictscoredown);
+  in.value(pscost.conflict_weight);
+  in.value(pscost.conflict_avg_score);
+  in.value(pscost.cost_total);
+  in.value(pscost.inferences_total);
+  in.value(pscost.nsamplestotal);
+  in.value(pscost.ninferencestotal);
+  in.value(pscost.ncutoffstotal);
+
+  bool valid = in.ok && (HighsInt)colLower.size() == numCol &&
+               (HighsInt)colUpper.size() == numCol &&
+               (HighsInt)pscost.pseudocostup.size() == numCol &&
+               (HighsInt)pscost.pseudocostdown.size() == numCol &&
+               (HighsInt)pscost.nsamplesup.size() == numCol &&
+               (HighsInt)pscost.nsamplesdown.size() == numCol &&
+               (HighsInt)pscost.inferencesup.size() == numCol &&
+               (HighsInt)pscost.inferencesdown.size() == numCol &&
+               (HighsInt)pscost.ninferencesup.size() == numCol &&
+               (HighsInt)pscost.ninferencesdown.size() == numCol &&
+               (HighsInt)pscost.ncutoffsup.size() == numCol &&
+               (HighsInt)pscost.ncutoffsdown.size() == numCol &&
+               (HighsInt)pscost.conflictscoreup.size() == numCol &&
+               (HighsInt)pscost.conflictscoredown.size() == numCol;
+
+  HighsInt numCuts = 0;
+  std::vector<HighsInt> cutStart{0};
+  std::vector<HighsInt> cutIndex;
+  std::vector<double> cutValue;
+  std::vector<double> cutRhs;
+  std::vector<uint8_t> cutIntegral;
+  in.value(numCuts);
+  for (HighsInt i = 0; valid && i < numCuts; ++i) {
+    std::vector<HighsInt> inds;
+    std::vector<double> vals;
+    double rhs;
+    uint8_t integral;
+    in.vector(inds);
+    in.vector(vals);
+    in.value(rhs);
+    in.value(integral);
+    valid = in.ok && inds.size() == vals.size();
+    for (HighsInt col : inds) valid = valid && col >= 0 && col < numCol;
+    cutIndex.insert(cutIndex.end(), inds.begin(), inds.end());
+    cutValue.insert(cutValue.end(), vals.begin(), vals.end());
+    cutStart.push_back(cutIndex.size());
+    cutRhs.push_back(rhs);
+    cutIntegral.push_back(integral);
+  }
+
+  HighsInt numConflicts = 0;
+  std::vector<std::vector<HighsDomainChange>> conflicts;
+  in.value(numConflicts);
+  for (HighsInt i = 0; valid && i < numConflicts; ++i) {
+    conflicts.emplace_back();
+    in.vector(conflicts.back());
+    valid = in.ok && validDomainChanges(conflicts.back(), numCol);
+  }
+
+  int64_t numOpenNodes = 0;
+  std::vector<HighsNodeQueue::OpenNode> openNodes;
+  in.value(numOpenNodes);
+  for (int64_t i = 0; valid && i < numOpenNodes; ++i) {
+    double lowerBound;
+    double estimate;
+    HighsInt depth;
+    std::vector<HighsDomainChange> domchgstack;
+    std::vector<HighsInt> branchings;
+    in.value(lowerBound);
+    in.value(estimate);
+    in.value(depth);
+    in.vector(domchgstack);
+    in.vector(branchings);
+    valid = in.ok && validDomainChanges(domchgstack, numCol);
+    for (HighsInt pos : branchings)
+      valid = valid && pos >= 0 && pos < (HighsInt)domchgstack.size();
+    openNodes.emplace_back(std::move(domchgstack), std::move(branchings),
+                           lowerBound, estimate, depth);
+  }
+
+  in.value(magic);
+  if (!valid || !in.ok ||
+      std::memcmp(magic, kCheckpointMagic, sizeof(kCheckpointMagic)) != 0) {
+    highsLogUser(options.log_options, HighsLogType::kWarning,
+                 "Checkpoint file %s is corrupt, only the incumbent is "
+                 "restored\n",
+                 filename.c_str());
+    return false;
+  }
+
+  mipdata.num_nodes = numNodes;
+  mipdata.num_leaves = numLeaves;
+  mipdata.pruned_treeweight = prunedTreeweight;
+  mipdata.total_lp_iterations = totalLpIterations;
+  mipdata.heuristic_lp_iterations = heuristicLpIterations;
+  mipdata.sepa_lp_iterations = sepaLpIterations;
+  mipdata.sb_lp_iterations = sbLpIterations;
+
+  if (basisValid && (HighsInt)rootBasis.col_status.size() == numCol &&
+      (HighsInt)rootBasis.row_status.size() >= mipsolver.numRow()) {
+    rootBasis.valid = true;
+    mipdata.firstrootbasis = std::move(rootBasis);
+  }
+
+  mipdata.pseudocost = std::move(pscost);
+
+  for (HighsInt i = 0; i != numCuts; ++i)
+    mipdata.cutpool.addCut(mipsolver, cutIndex.data() + cutStart[i],
+                           cutValue.data() + cutStart[i],
+                           cutStart[i + 1] - cutStart[i], cutRhs[i],
+                           cutIntegral[i], true, false, false);
+
+  for (const std::vector<HighsDomainChange>& conflict : conflicts)
+    mipdata.conflictPool.addConflictCut(conflict);
+
+  HighsDomain& domain = mipdata.domain;
+  for (HighsInt col = 0; col != numCol && !domain.infeasible(); ++col) {
+    if (colLower[col] > domain.col_lower_[col])
+      domain.changeBound(HighsBoundType::kLower, col, colLower[col],
+                         HighsDomain::Reason::unspecified());
+    if (domain.infeasible()) break;
+    if (colUpper[col] < domain.col_upper_[col])
+      domain.changeBound(HighsBoundType::kUpper, col, colUpper[col],
+                         HighsDomain::Reason::unspecified());
+  }
+  domain.propagate();
+
+  mipdata.nodequeue.clear();
+  mipdata.nodequeue.setOptimalityLimit(mipdata.optimality_limit);
+
+  if (domain.infeasible()) {
+    mipdata.pruned_treeweight = 1.0;
+    mipdata.lower_bound = std::min(kHighsInf, mipdata.upper_bound);
+    return true;
+  }
+
+  if (!domain.getChangedCols().empty()) {
+    mipdata.cliquetable.cleanupFixed(domain);
+    for (HighsInt col : domain.getChangedCols())
+      mipdata.implications.cleanupVarbounds(col);
+
+    domain.setDomainChangeStack(std::vector<HighsDomainChange>());
+    domain.clearChangedCols();
+    mipdata.removeFixedIndices();
+  }
+
+  for (HighsNodeQueue::OpenNode& node : openNodes) {
+    if (node.lower_bound >= mipdata.upper_limit) {
+      mipdata.pruned_treeweight += std::ldexp(1.0, 1 - node.depth);
+      continue;
+    }
+    // suboptimal nodes are stored with an infinite estimate
+    double estimate =
+        node.estimate == kHighsInf ? node.lower_bound : node.estimate;
+    mipdata.pruned_treeweight += mipdata.nodequeue.emplaceNode(
+        std::move(node.domchgstack), std::move(node.branchings),
+        node.lower_bound, estimate, node.depth);
+  }
+  mipdata.pruned_treeweight +=
+      mipdata.nodequeue.pruneInfeasibleNodes(domain, mipdata.feastol);
+  mipdata.lower_bound = std::min(mipdata.upper_bound,
+                                 mipdata.nodequeue.getBestLowerBound());
+
+  highsLogUser(options.log_options, HighsLogType::kInfo,
+               "Resuming the search from checkpoint file %s with %" PRId64
+               " open nodes\n",
+               filename.c_str(), mipdata.nodequeue.numNodes());
+
+  return true;
+}
@@ -0,0 +1,59 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsMipCheckpoint.h
+ * @brief Checkpoints of the branch-and-bound search for resuming an
+ * interrupted MIP solve
+ */
+
+#ifndef HIGHS_MIP_CHECKPOINT_H_
+#define HIGHS_MIP_CHECKPOINT_H_
+
+#include <cstdint>
+
+#include "lp_data/HighsLp.h"
+
+class HighsMipSolver;
+
+/// A checkpoint holds the incumbent, the global domain, the open nodes, the
+/// contents of the cut and conflict pools, the pseudocosts and the root basis
+/// of the search. The incumbent is stored in the space of the original model
+/// and can always be restored when the original model is the same. All other
+/// data refers to the presolved model and is only restored when the presolved
+/// model at the time of writing is reproduced after the root node, which is
+/// not the case if the search was restarted after the root node.
+class HighsMipCheckpoint {
+ public:
+  static constexpr uint32_t kVersion = 1;
+
+  HighsMipCheckpoint(HighsMipSolver& mipsolver);
+
+  /// returns whether a checkpoint file is configured and the checkpoint
+  /// interval has passed since the last checkpoint was written
+  bool due() const;
+
+  /// writes the state of the search to the checkpoint file if one is
+  /// configured. Must be called while no node is installed in the search, so
+  /// that all open nodes are held in the node queue.
+  void write();
+
+  /// restores the state of the search from the resume file if one is
+  /// configured. Must be called after the root node was evaluated and
+  /// returns whether the open nodes of the checkpoint were restored.
+  bool resume();
+
+  static uint64_t modelHash(const HighsLp& model);
+
+ private:
+  HighsMipSolver& mipsolver;
+  double lastWriteTime;
+};
+
+#endif
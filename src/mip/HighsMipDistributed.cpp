@@ -0,0 +1,527 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsMipDistributed.h"
+
+#include <cerrno>
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#include "mip/HighsMipSolverData.h"
+#include "util/stringutil.h"
+
+namespace {
+
+// identifies the messages of the protocol, together with its version
+constexpr uint32_t kMessageMagic = 0x48694d50;
+constexpr uint32_t kProtocolVersion = 1;
+
+enum class MessageType : uint32_t {
+  kSubtreeTask = 1,
+  kSubtreeResult = 2,
+};
+
+struct MessageWriter {
+  std::vector<char>& buffer;
+
+  template <typename T>
+  void value(const T& val) {
+    const char* bytes = reinterpret_cast<const char*>(&val);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+  }
+
+  template <typename T>
+  void vector(const std::vector<T>& vec) {
+    value(HighsInt(vec.size()));
+    const char* bytes = reinterpret_cast<const char*>(vec.data());
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T) * vec.size());
+  }
+
+  void header(MessageType type) {
+    buffer.clear();
+    value(kMessageMagic);
+    value(kProtocolVersion);
+    value(type);
+  }
+};
+
+struct MessageReader {
+  const std::vector<char>& buffer;
+  size_t pos;
+  bool ok;
+
+  template <typename T>
+  void value(T& val) {
+    ok = ok && pos + sizeof(T) <= buffer.size();
+    if (!ok) return;
+    std::memcpy(&val, buffer.data() + pos, sizeof(T));
+    pos += sizeof(T);
+  }
+
+  template <typename T>
+  void vector(std::vector<T>& vec) {
+    HighsInt len = -1;
+    value(len);
+    ok = ok && len >= 0 && pos + sizeof(T) * size_t(len) <= buffer.size();
+    if (!ok) return;
+    vec.resize(len);
+    std::memcpy(vec.data(), buffer.data() + pos, sizeof(T) * size_t(len));
+    pos += sizeof(T) * size_t(len);
+  }
+
+  void header(MessageType type) {
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    MessageType messageType;
+    value(magic);
+    value(version);
+    value(messageType);
+    ok = ok && magic == kMessageMagic && version == kProtocolVersion &&
+         messageType == type;
+  }
+
+  bool finished() const { return ok && pos == buffer.size(); }
+};
+
+bool validDomainChanges(const std::vector<HighsDomainChange>& domchgs,
+                        HighsInt numCol) {
+  for (const HighsDomainChange& domchg : domchgs)
+    if (domchg.column < 0 || domchg.column >= numCol) return false;
+
+  return true;
+}
+
+#ifndef _WIN32
+void configureSocket(int fd) {
+#ifdef SO_NOSIGPIPE
+  // a closed connection must be reported by send() and not raise SIGPIPE
+  int on = 1;
+  setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#else
+  (void)fd;
+#endif
+}
+
+bool sendBytes(int fd, const char* data, size_t len) {
+#ifdef MSG_NOSIGNAL
+  const int flags = MSG_NOSIGNAL;
+#else
+  const int flags = 0;
+#endif
+  while (len != 0) {
+    ssize_t n = ::send(fd, data, len, flags);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    data += n;
+    len -= n;
+  }
+  return true;
+}
+
+bool receiveBytes(int fd, char* data, size_t len) {
+  while (len != 0) {
+    ssize_t n = ::recv(fd, data, len, 0);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    data += n;
+    len -= n;
+  }
+  return true;
+}
+
+bool socketAddress(const std::string& path, sockaddr_un& address) {
+  std::memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if (path.empty() || path.size() >= sizeof(address.sun_path)) return false;
+  std::memcpy(address.sun_path, path.c_str(), path.size());
+  return true;
+}
+#endif
+
+}  // namespace
+
+HighsSocketTransport::~HighsSocketTransport() {
+#ifndef _WIN32
+  if (fd != -1) close(fd);
+#endif
+}
+
+bool HighsSocketTransport::send(const std::vector<char>& message) {
+#ifndef _WIN32
+  uint64_t len = message.size();
+  return sendBytes(fd, reinterpret_cast<const char*>(&len), sizeof(len)) &&
+         sendBytes(fd, message.data(), message.size());
+#else
+  return false;
+#endif
+}
+
+bool HighsSocketTransport::receive(std::vector<char>& message) {
+#ifndef _WIN32
+  uint64_t len = 0;
+  if (!receiveBytes(fd, reinterpret_cast<char*>(&len), sizeof(len)))
+    return false;
+  message.resize(len);
+  return receiveBytes(fd, message.data(), len);
+#else
+  return false;
+#endif
+}
+
+std::unique_ptr<HighsSocketTransport> HighsSocketTransport::connect(
+    const std::string& path) {
+#ifndef _WIN32
+  sockaddr_un address;
+  if (!socketAddress(path, address)) return nullptr;
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd == -1) return nullptr;
+  if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) !=
+      0) {
+    close(fd);
+    return nullptr;
+  }
+  configureSocket(fd);
+
+  return std::unique_ptr<HighsSocketTransport>(new HighsSocketTransport(fd));
+#else
+  return nullptr;
+#endif
+}
+
+bool HighsSocketTransport::createPair(
+    std::unique_ptr<HighsSocketTransport>& first,
+    std::unique_ptr<HighsSocketTransport>& second) {
+#ifndef _WIN32
+  int fds[2];
+  if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) return false;
+  configureSocket(fds[0]);
+  configureSocket(fds[1]);
+
+  first.reset(new HighsSocketTransport(fds[0]));
+  second.reset(new HighsSocketTransport(fds[1]));
+  return true;
+#else
+  return false;
+#endif
+}
+
+HighsSocketListener::~HighsSocketListener() {
+#ifndef _WIN32
+  if (fd == -1) return;
+  close(fd);
+  unlink(path.c_str());
+#endif
+}
+
+bool HighsSocketListener::listen(const std::string& path) {
+#ifndef _WIN32
+  sockaddr_un address;
+  if (fd != -1 || !socketAddress(path, address)) return false;
+
+  // a socket file left behind by a previous worker is replaced, but no other
+  // kind of file
+  struct stat status;
+  if (stat(path.c_str(), &status) == 0) {
+    if (!S_ISSOCK(status.st_mode)) return false;
+    unlink(path.c_str());
+  }
+
+  fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd == -1) return false;
+  if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+      ::listen(fd, 16) != 0) {
+    close(fd);
+    fd = -1;
+    return false;
+  }
+  this->path = path;
+  return true;
+#else
+  return false;
+#endif
+}
+
+std::unique_ptr<HighsSocketTransport> HighsSocketListener::accept() {
+#ifndef _WIN32
+  if (fd == -1) return nullptr;
+
+  int connection;
+  do {
+    connection = ::accept(fd, nullptr, nullptr);
+  } while (connection == -1 && errno == EINTR);
+  if (connection == -1) return nullptr;
+  configureSocket(connection);
+
+  return std::unique_ptr<HighsSocketTransport>(
+      new HighsSocketTransport(connection));
+#else
+  return nullptr;
+#endif
+}
+
+void HighsSubtreeResult::extract(HighsMipSolver& subtree) {
+  HighsMipSolverData& subdata = *subtree.mipdata_;
+
+  valid = true;
+  model_status = subtree.modelstatus_;
+  solution = subtree.solution_;
+  lower_bound = subdata.lower_bound;
+  upper_bound = subdata.upper_bound;
+  num_nodes = subdata.num_nodes;
+  num_leaves = subdata.num_leaves;
+  lp_iterations = subdata.total_lp_iterations;
+  col_lower = subdata.domain.col_lower_;
+  col_upper = subdata.domain.col_upper_;
+
+  open_nodes.clear();
+  open_nodes.reserve(subdata.nodequeue.numNodes());
+  while (!subdata.nodequeue.empty()) {
+    HighsNodeQueue::OpenNode node = subdata.nodequeue.popBestBoundNode();
+    open_nodes.push_back(OpenNode{std::move(node.domchgstack),
+                                  std::move(node.branchings), node.lower_bound,
+                                  node.estimate, node.depth});
+  }
+}
+
+void HighsSubtreeResult::write(std::vector<char>& message) const {
+  MessageWriter out{message};
+  out.header(MessageType::kSubtreeResult);
+  out.value(model_status);
+  out.vector(solution);
+  out.value(lower_bound);
+  out.value(upper_bound);
+  out.value(num_nodes);
+  out.value(num_leaves);
+  out.value(lp_iterations);
+  out.vector(col_lower);
+  out.vector(col_upper);
+  out.value(HighsInt(open_nodes.size()));
+  for (const OpenNode& node : open_nodes) {
+    out.vector(node.domchgstack);
+    out.vector(node.branchings);
+    out.value(node.lower_bound);
+    out.value(node.estimate);
+    out.value(node.depth);
+  }
+}
+
+bool HighsSubtreeResult::read(const std::vector<char>& message,
+                              HighsInt numCol) {
+  MessageReader in{message, 0, true};
+  in.header(MessageType::kSubtreeResult);
+  in.value(model_status);
+  in.vector(solution);
+  in.value(lower_bound);
+  in.value(upper_bound);
+  in.value(num_nodes);
+  in.value(num_leaves);
+  in.value(lp_iterations);
+  in.vector(col_lower);
+  in.vector(col_upper);
+  HighsInt numOpenNodes = -1;
+  in.value(numOpenNodes);
+  valid = in.ok && numOpenNodes >= 0 &&
+          (solution.empty() || (HighsInt)solution.size() == numCol) &&
+          (HighsInt)col_lower.size() == numCol &&
+          (HighsInt)col_upper.size() == numCol;
+  if (!valid) return false;
+
+  open_nodes.clear();
+  for (HighsInt i = 0; i != numOpenNodes; ++i) {
+    OpenNode node;
+    in.vector(node.domchgstack);
+    in.vector(node.branchings);
+    in.value(node.lower_bound);
+    in.value(node.estimate);
+    in.value(node.depth);
+    valid = in.ok && node.depth >= 1 &&
+            validDomainChanges(node.domchgstack, numCol);
+    for (HighsInt pos : node.branchings)
+      valid = valid && pos >= 0 && pos < (HighsInt)node.domchgstack.size();
+    if (!valid) return false;
+    open_nodes.push_back(std::move(node));
+  }
+
+  valid = in.finished();
+  return valid;
+}
+
+void setSubtreeOptions(HighsOptions& options, int64_t nodeLimit) {
+  // Presolve is switched off so that the subtree search operates on the
+  // columns of the subtree model and its open nodes can be put back into the
+  // node queue of the supervisor.
+  options.output_flag = false;
+  options.presolve = kHighsOffString;
+  options.mip_detect_symmetry = false;
+  options.mip_max_nodes = (HighsInt)nodeLimit;
+  options.mip_max_leaves = kHighsIInf;
+  options.mip_max_stall_nodes = kHighsIInf;
+  options.mip_max_improving_sols = kHighsIInf;
+  options.mip_rel_gap = 0.0;
+}
+
+void writeSubtreeTask(std::vector<char>& message, const HighsLp& lp,
+                      const HighsBasis& basis, const HighsOptions& options) {
+  assert(lp.a_matrix_.isColwise());
+  MessageWriter out{message};
+  out.header(MessageType::kSubtreeTask);
+  out.value(lp.num_col_);
+  out.value(lp.num_row_);
+  out.value(lp.sense_);
+  out.value(lp.offset_);
+  out.vector(lp.col_cost_);
+  out.vector(lp.col_lower_);
+  out.vector(lp.col_upper_);
+  out.vector(lp.row_lower_);
+  out.vector(lp.row_upper_);
+  out.vector(lp.a_matrix_.start_);
+  out.vector(lp.a_matrix_.index_);
+  out.vector(lp.a_matrix_.value_);
+  out.vector(lp.integrality_);
+
+  out.value(basis.valid);
+  out.vector(basis.col_status);
+  out.vector(basis.row_status);
+
+  out.value(int64_t{options.mip_max_nodes});
+  out.value(options.time_limit);
+  out.value(options.objective_bound);
+  out.value(options.mip_feasibility_tolerance);
+  out.value(options.primal_feasibility_tolerance);
+  out.value(options.dual_feasibility_tolerance);
+  out.value(options.random_seed);
+}
+
+bool readSubtreeTask(const std::vector<char>& message, HighsLp& lp,
+                     HighsBasis& basis, HighsOptions& options) {
+  MessageReader in{message, 0, true};
+  in.header(MessageType::kSubtreeTask);
+  lp.clear();
+  in.value(lp.num_col_);
+  in.value(lp.num_row_);
+  in.value(lp.sense_);
+  in.value(lp.offset_);
+  in.vector(lp.col_cost_);
+  in.vector(lp.col_lower_);
+  in.vector(lp.col_upper_);
+  in.vector(lp.row_lower_);
+  in.vector(lp.row_upper_);
+  HighsSparseMatrix& matrix = lp.a_matrix_;
+  matrix.format_ = MatrixFormat::kColwise;
+  matrix.num_col_ = lp.num_col_;
+  matrix.num_row_ = lp.num_row_;
+  in.vector(matrix.start_);
+  in.vector(matrix.index_);
+  in.vector(matrix.value_);
+  in.vector(lp.integrality_);
+
+  basis.clear();
+  in.value(basis.valid);
+  in.vector(basis.col_status);
+  in.vector(basis.row_status);
+
+  int64_t nodeLimit = 0;
+  in.value(nodeLimit);
+  in.value(options.time_limit);
+  in.value(options.objective_bound);
+  in.value(options.mip_feasibility_tolerance);
+  in.value(options.primal_feasibility_tolerance);
+  in.value(options.dual_feasibility_tolerance);
+  in.value(options.random_seed);
+  if (!in.finished()) return false;
+
+  const HighsInt numCol = lp.num_col_;
+  const HighsInt numRow = lp.num_row_;
+  bool valid = numCol >= 0 && numRow >= 0 &&
+               (HighsInt)lp.col_cost_.size() == numCol &&
+               (HighsInt)lp.col_lower_.size() == numCol &&
+               (HighsInt)lp.col_upper_.size() == numCol &&
+               (HighsInt)lp.row_lower_.size() == numRow &&
+               (HighsInt)lp.row_upper_.size() == numRow &&
+               (HighsInt)lp.integrality_.size() == numCol &&
+               (HighsInt)matrix.start_.size() == numCol + 1 &&
+               matrix.start_[0] == 0 &&
+               matrix.start_[numCol] == (HighsInt)matrix.index_.size() &&
+               matrix.index_.size() == matrix.value_.size() && nodeLimit >= 1;
+  for (HighsInt i = 0; valid && i != numCol; ++i)
+    valid = matrix.start_[i] <= matrix.start_[i + 1];
+  for (HighsInt row : matrix.index_)
+    valid = valid && row >= 0 && row < numRow;
+  if (!valid) return false;
+
+  if (basis.valid && ((HighsInt)basis.col_status.size() != numCol ||
+                      (HighsInt)basis.row_status.size() != numRow))
+    basis.invalidate();
+  basis.alien = false;
+
+  setSubtreeOptions(options, nodeLimit);
+  return true;
+}
+
+void connectMipWorkers(
+    const std::string& paths, const HighsLogOptions& log_options,
+    std::vector<std::shared_ptr<HighsMipTransport>>& workers) {
+  size_t start = 0;
+  while (start <= paths.size()) {
+    size_t end = paths.find(',', start);
+    if (end == std::string::npos) end = paths.size();
+    std::string path = paths.substr(start, end - start);
+    start = end + 1;
+
+    trim(path);
+    if (path.empty()) continue;
+    std::shared_ptr<HighsMipTransport> worker =
+        HighsSocketTransport::connect(path);
+    if (worker)
+      workers.push_back(std::move(worker));
+    else
+      highsLogUser(log_options, HighsLogType::kWarning,
+                   "Cannot connect to MIP worker at %s\n", path.c_str());
+  }
+}
+
+HighsStatus runMipWorker(HighsMipTransport& transport,
+                         const HighsOptions& options) {
+  std::vector<char> message;
+  while (transport.receive(message)) {
+    HighsLp lp;
+    HighsBasis basis;
+    HighsOptions subtreeoptions = options;
+    if (!readSubtreeTask(message, lp, basis, subtreeoptions)) {
+      highsLogUser(options.log_options, HighsLogType::kError,
+                   "Received an invalid subtree task from the MIP "
+                   "supervisor\n");
+      return HighsStatus::kError;
+    }
+
+    HighsCallback callback;
+    HighsSolution solution;
+    solution.value_valid = false;
+    solution.dual_valid = false;
+    HighsMipSolver subtree(callback, subtreeoptions, lp, solution, true);
+    if (basis.valid) subtree.rootbasis = &basis;
+    subtree.run();
+
+    HighsSubtreeResult result;
+    result.extract(subtree);
+    result.write(message);
+    if (!transport.send(message)) return HighsStatus::kError;
+  }
+
+  // the supervisor closed the connection
+  return HighsStatus::kOk;
+}
@@ -0,0 +1,150 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsMipDistributed.h
+ * @brief Distribution of subtrees of the branch-and-bound search to worker
+ * processes
+ */
+
+#ifndef HIGHS_MIP_DISTRIBUTED_H_
+#define HIGHS_MIP_DISTRIBUTED_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "lp_data/HighsLp.h"
+#include "lp_data/HighsOptions.h"
+#include "mip/HighsDomainChange.h"
+
+class HighsMipSolver;
+
+/// Connection between the supervisor of a distributed MIP solve and one of
+/// its workers. Implementations deliver complete messages in the order in
+/// which they were sent and return false when the connection is broken or
+/// was closed by the other side, after which it is not used again.
+class HighsMipTransport {
+ public:
+  virtual ~HighsMipTransport() = default;
+
+  virtual bool send(const std::vector<char>& message) = 0;
+
+  /// blocks until a complete message was received
+  virtual bool receive(std::vector<char>& message) = 0;
+};
+
+/// Transport over a connected stream socket, in which each message is
+/// preceded by its length. Sockets are not supported on Windows, where the
+/// factory functions fail.
+class HighsSocketTransport : public HighsMipTransport {
+  int fd;
+
+ public:
+  explicit HighsSocketTransport(int fd) : fd(fd) {}
+  ~HighsSocketTransport() override;
+
+  HighsSocketTransport(const HighsSocketTransport&) = delete;
+  HighsSocketTransport& operator=(const HighsSocketTransport&) = delete;
+
+  bool send(const std::vector<char>& message) override;
+
+  bool receive(std::vector<char>& message) override;
+
+  /// connects to a worker that listens on the Unix socket at the given path
+  static std::unique_ptr<HighsSocketTransport> connect(const std::string& path);
+
+  /// creates two transports that are connected to each other
+  static bool createPair(std::unique_ptr<HighsSocketTransport>& first,
+                         std::unique_ptr<HighsSocketTransport>& second);
+};
+
+/// Unix socket on which a worker process accepts the connections of
+/// supervisors. The socket file is removed on destruction.
+class HighsSocketListener {
+  int fd;
+  std::string path;
+
+ public:
+  HighsSocketListener() : fd(-1) {}
+  ~HighsSocketListener();
+
+  HighsSocketListener(const HighsSocketListener&) = delete;
+  HighsSocketListener& operator=(const HighsSocketListener&) = delete;
+
+  bool listen(const std::string& path);
+
+  /// blocks until the next supervisor connects
+  std::unique_ptr<HighsSocketTransport> accept();
+};
+
+/// Outcome of searching the subtree of one node, either on a thread of the
+/// supervisor or in a worker process. The open nodes and the bounds of the
+/// global domain refer to the columns of the subtree model, and the domain
+/// changes of the open nodes are relative to that global domain.
+struct HighsSubtreeResult {
+  struct OpenNode {
+    std::vector<HighsDomainChange> domchgstack;
+    std::vector<HighsInt> branchings;
+    double lower_bound;
+    double estimate;
+    HighsInt depth;
+  };
+
+  /// false if the subtree was not searched because the worker was lost
+  bool valid = false;
+  HighsModelStatus model_status = HighsModelStatus::kNotset;
+  std::vector<double> solution;
+  double lower_bound = -kHighsInf;
+  double upper_bound = kHighsInf;
+  int64_t num_nodes = 0;
+  int64_t num_leaves = 0;
+  int64_t lp_iterations = 0;
+  std::vector<double> col_lower;
+  std::vector<double> col_upper;
+  std::vector<OpenNode> open_nodes;
+
+  /// takes the result of a finished subtree search and moves its open nodes
+  /// out of the node queue
+  void extract(HighsMipSolver& subtree);
+
+  void write(std::vector<char>& message) const;
+
+  /// reads a result for a subtree model with the given number of columns
+  /// and returns whether the message is a valid result
+  bool read(const std::vector<char>& message, HighsInt numCol);
+};
+
+/// sets the options that all subtree searches have in common, the time
+/// limit and the objective bound are left to the caller
+void setSubtreeOptions(HighsOptions& options, int64_t nodeLimit);
+
+/// writes the task of searching the subtree with the given model, which has
+/// the bounds of the subtree root, and the given root basis and options
+void writeSubtreeTask(std::vector<char>& message, const HighsLp& lp,
+                      const HighsBasis& basis, const HighsOptions& options);
+
+/// reads a subtree task, the options that are part of the task overwrite
+/// the given options
+bool readSubtreeTask(const std::vector<char>& message, HighsLp& lp,
+                     HighsBasis& basis, HighsOptions& options);
+
+/// connects to the workers listening on the comma separated list of socket
+/// paths and appends the connections to workers
+void connectMipWorkers(
+    const std::string& paths, const HighsLogOptions& log_options,
+    std::vector<std::shared_ptr<HighsMipTransport>>& workers);
+
+/// searches the subtrees sent by a supervisor until it closes the
+/// connection
+HighsStatus runMipWorker(HighsMipTransport& transport,
+                         const HighsOptions& options);
+
+#endif
@@ -17,6 +17,7 @@
 #include "mip/HighsDomain.h"
 #include "mip/HighsImplications.h"
 #include "mip/HighsLpRelaxation.h"
+#include "mip/HighsMipCheckpoint.h"
 #include "mip/HighsMipSolverData.h"
 #include "mip/HighsPseudocost.h"
 #include "mip/HighsSearch.h"
@@ -41,7 +42,10 @@ HighsMipSolver::HighsMipSolver(HighsCallback& callback,
       rootbasis(nullptr),
       pscostinit(nullptr),
       clqtableinit(nullptr),
-      implicinit(nullptr) {
+      implicinit(nullptr),
+      warmstart(nullptr),
+      mipstarts(nullptr),
+      workers(nullptr) {
   if (solution.value_valid) {
     // MIP solver doesn't check row residuals, but they should be OK
     // so validate using assert
@@ -127,7 +131,24 @@ void HighsMipSolver::run() {
     return;
   }
 
+  // the pseudocosts of a warm start are used for the initialization of the
+  // pseudocosts in the setup, its other data is imported afterwards
+  const bool useWarmStart =
+      !submip && warmstart != nullptr && warmstart->valid;
+  if (useWarmStart && warmstart->pseudocost != nullptr &&
+      (HighsInt)warmstart->pseudocost->pseudocostup.size() ==
+          orig_model_->num_col_)
+    pscostinit = warmstart->pseudocost.get();
   mipdata_->runSetup();
+  if (useWarmStart) {
+    pscostinit = nullptr;
+    mipdata_->importWarmStart(*warmstart);
+  }
+  if (!submip && mipstarts != nullptr && !mipstarts->empty() &&
+      modelstatus_ == HighsModelStatus::kNotset)
+    mipdata_->heuristics.completeMipStarts(*mipstarts);
+  HighsMipCheckpoint checkpoint(*this);
+  bool resumeFromCheckpoint = true;
 restart:
   if (modelstatus_ == HighsModelStatus::kNotset) {
     mipdata_->evaluateRootNode();
@@ -139,6 +160,14 @@ restart:
     mipdata_->cutpool.performAging();
     mipdata_->cutpool.performAging();
   }
+  // the state of an interrupted search is restored after the root node, when
+  // the restarts at the root node have reproduced its presolved model
+  if (resumeFromCheckpoint) {
+    resumeFromCheckpoint = false;
+    if (modelstatus_ == HighsModelStatus::kNotset &&
+        !mipdata_->nodequeue.empty())
+      checkpoint.resume();
+  }
   if (mipdata_->nodequeue.empty()) {
     cleanupSolve();
     return;
@@ -197,6 +226,9 @@ restart:
           if (mipdata_->incumbent.empty())
             mipdata_->heuristics.RENS(
                 mipdata_->lp.getLpSolver().getSolution().col_value);
+          else if (options_mip_->mip_lns_portfolio && !submip)
+            mipdata_->heuristics.largeNeighbourhoodSearch(
+                mipdata_->lp.getLpSolver().getSolution().col_value);
           else
             mipdata_->heuristics.RINS(
                 mipdata_->lp.getLpSolver().getSolution().col_value);
@@ -250,6 +282,14 @@ restart:
     // the search datastructure should have no installed node now
     assert(!search.hasNode());
 
+    // search the subtrees of the best bound nodes on the available threads
+    if (mipdata_->searchSubtreesInParallel() && mipdata_->checkLimits()) {
+      mipdata_->lower_bound = std::min(mipdata_->upper_bound,
+                                       mipdata_->nodequeue.getBestLowerBound());
+      mipdata_->printDisplayLine();
+      break;
+    }
+
     // propagate the global domain
     mipdata_->domain.propagate();
     mipdata_->pruned_treeweight += mipdata_->nodequeue.pruneInfeasibleNodes(
@@ -285,6 +325,8 @@ restart:
       mipdata_->removeFixedIndices();
     }
 
+    if (checkpoint.due()) checkpoint.write();
+
     if (!submip && mipdata_->num_nodes >= nextCheck) {
       auto nTreeRestarts = mipdata_->numRestarts - mipdata_->numRestartsRoot;
       double currNodeEstim =
@@ -480,9 +522,95 @@ restart:
     if (limit_reached) break;
   }
 
+  // keep the state of an interrupted search so that it can be resumed
+  if (!search.hasNode() && !mipdata_->nodequeue.empty()) checkpoint.write();
+
+  mipdata_->heuristics.finishConcurrentLns();
   cleanupSolve();
 }
 
+void HighsMipSolver::exportWarmStart(HighsMipWarmStart& warmstart) const {
+  warmstart.clear();
+  if (!mipdata_) return;
+
+  warmstart.valid = true;
+  warmstart.model_hash = HighsMipCheckpoint::modelHash(*orig_model_);
+
+  // the solution pool or, without one, the incumbent followed by the
+  // previous improving solutions
+  if (!mipdata_->solutionPool.empty()) {
+    warmstart.solutions = mipdata_->solutionPool;
+  } else if (solution_objective_ != kHighsInf) {
+    warmstart.solutions.emplace_back();
+    warmstart.solutions.back().objective = solution_objective_;
+    warmstart.solutions.back().col_value = solution_;
+    for (auto sol = mipdata_->improvingSolutions.rbegin();
+         sol != mipdata_->improvingSolutions.rend(); ++sol) {
+      if (sol->col_value != solution_) warmstart.solutions.push_back(*sol);
+    }
+  }
+
+  // the learned data refers to the presolved model and is only available if
+  // the search was set up for it
+  if (numCol() == 0 || mipdata_->pseudocost.getNumCol() != numCol()) return;
+
+  presolve::HighsPostsolveStack& postSolveStack = mipdata_->postSolveStack;
+  warmstart.pseudocost = std::make_shared<HighsPseudocostInitialization>(
+      mipdata_->pseudocost, options_mip_->mip_pscost_minreliable,
+      postSolveStack);
+
+  // cuts and conflicts can only be expressed in the original model if they
+  // have no columns whose values were transformed by presolve
+  std::vector<uint8_t> transformedOrigCols =
+      postSolveStack.getTransformedOrigCols();
+  auto transformed = [&](HighsInt col) {
+    return transformedOrigCols[postSolveStack.getOrigColIndex(col)] != 0;
+  };
+
+  const HighsCutPool& cutpool = mipdata_->cutpool;
+  HighsInt numCutRows = cutpool.getMatrix().getNumRows();
+  warmstart.cut_start.push_back(0);
+  for (HighsInt cut = 0; cut != numCutRows; ++cut) {
+    // deleted cuts have a start of -1
+    if (cutpool.getMatrix().getRowStart(cut) == -1) continue;
+    HighsInt cutlen;
+    const HighsInt* cutinds;
+    const double* cutvals;
+    cutpool.getCut(cut, cutlen, cutinds, cutvals);
+    if (std::any_of(cutinds, cutinds + cutlen, transformed)) continue;
+    for (HighsInt j = 0; j != cutlen; ++j) {
+      warmstart.cut_index.push_back(postSolveStack.getOrigColIndex(cutinds[j]));
+      warmstart.cut_value.push_back(cutvals[j]);
+    }
+    warmstart.cut_upper.push_back(cutpool.getRhs()[cut]);
+    warmstart.cut_start.push_back(warmstart.cut_index.size());
+  }
+
+  const HighsConflictPool& conflictPool = mipdata_->conflictPool;
+  const std::vector<HighsDomainChange>& conflictEntries =
+      conflictPool.getConflictEntryVector();
+  warmstart.conflict_start.push_back(0);
+  for (const std::pair<HighsInt, HighsInt>& range :
+       conflictPool.getConflictRanges()) {
+    // deleted conflicts have a range of -1,-1
+    if (range.first == -1) continue;
+    if (std::any_of(conflictEntries.begin() + range.first,
+                    conflictEntries.begin() + range.second,
+                    [&](const HighsDomainChange& domchg) {
+                      return transformed(domchg.column);
+                    }))
+      continue;
+    for (HighsInt j = range.first; j != range.second; ++j) {
+      warmstart.conflict_index.push_back(
+          postSolveStack.getOrigColIndex(conflictEntries[j].column));
+      warmstart.conflict_value.push_back(conflictEntries[j].boundval);
+      warmstart.conflict_is_lower.push_back(
+          conflictEntries[j].boundtype == HighsBoundType::kLower);
+    }
+    warmstart.conflict_start.push_back(warmstart.conflict_index.size());
+  }
+}
+
 void HighsMipSolver::cleanupSolve() {
   timer_.start(timer_.postsolve_clock);
   bool havesolution = solution_objective_ != kHighsInf;
@@ -508,6 +636,13 @@ void HighsMipSolver::cleanupSolve() {
   primal_bound_ = mipdata_->upper_bound + model_->offset_;
   node_count_ = mipdata_->num_nodes;
   total_lp_iterations_ = mipdata_->total_lp_iterations;
+  work_count_ = mipdata_->work_count;
+  solution_pool_ = mipdata_->solutionPool;
+  mipdata_->updateTreeSizeEstimate();
+  if (modelstatus_ == HighsModelStatus::kOptimal ||
+      modelstatus_ == HighsModelStatus::kInfeasible)
+    mipdata_->treeSizeEstimator.complete();
+  tree_size_estimate_ = mipdata_->treeSizeEstimator;
   dual_bound_ = std::min(dual_bound_, primal_bound_);
 
   // adjust objective sense in case of maximization problem
@@ -610,6 +745,9 @@ void HighsMipSolver::cleanupSolve() {
                (long long unsigned)mipdata_->sb_lp_iterations,
                (long long unsigned)mipdata_->sepa_lp_iterations,
                (long long unsigned)mipdata_->heuristic_lp_iterations);
+  highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
+               "  Work              %llu\n",
+               (long long unsigned)work_count_);
 
   assert(modelstatus_ != HighsModelStatus::kNotset);
 }
@@ -14,12 +14,14 @@
 #include "Highs.h"
 #include "lp_data/HighsCallback.h"
 #include "lp_data/HighsOptions.h"
+#include "mip/HighsTreeSizeEstimator.h"
 
 struct HighsMipSolverData;
 class HighsCutPool;
 struct HighsPseudocostInitialization;
 class HighsCliqueTable;
 class HighsImplications;
+class HighsMipTransport;
 
 class HighsMipSolver {
  public:
@@ -40,6 +42,9 @@ class HighsMipSolver {
   double gap_;
   int64_t node_count_;
   int64_t total_lp_iterations_;
+  int64_t work_count_;
+  std::vector<HighsObjectiveSolution> solution_pool_;
+  HighsTreeSizeEstimator tree_size_estimate_;
 
   FILE* improving_solution_file_;
   std::vector<HighsObjectiveSolution> saved_objective_and_solution_;
@@ -49,11 +54,18 @@ class HighsMipSolver {
   const HighsPseudocostInitialization* pscostinit;
   const HighsCliqueTable* clqtableinit;
   const HighsImplications* implicinit;
+  const HighsMipWarmStart* warmstart;
+  const std::vector<HighsMipStart>* mipstarts;
+  std::vector<std::shared_ptr<HighsMipTransport>>* workers;
 
   std::unique_ptr<HighsMipSolverData> mipdata_;
 
   void run();
 
+  /// exports the solutions, pseudocosts, cuts and conflicts of the search
+  /// for warm starting the solve of a related model
+  void exportWarmStart(HighsMipWarmStart& warmstart) const;
+
   HighsInt numCol() const { return model_->num_col_; }
 
   HighsInt numRow() const { return model_->num_row_; }
@@ -14,6 +14,7 @@
 
 // #include "lp_data/HighsLpUtils.h"
 #include "lp_data/HighsModelUtils.h"
+#include "mip/HighsMipCheckpoint.h"
 #include "mip/HighsPseudocost.h"
 #include "mip/HighsRedcostFixing.h"
 #include "parallel/HighsParallel.h"
@@ -21,6 +22,10 @@
 #include "presolve/HPresolve.h"
 #include "util/HighsIntegers.h"
 
+// maximal number of solutions that are kept for warm starting a related solve
+// and of infeasible warm start solutions that are searched with RINS
+constexpr size_t kMaxWarmStartSolutions = 5;
+
 bool HighsMipSolverData::checkSolution(
     const std::vector<double>& solution) const {
   for (HighsInt i = 0; i != mipsolver.model_->num_col_; ++i) {
@@ -212,6 +217,152 @@ void HighsMipSolverData::finishSymmetryDetection(
     globalOrbits = symmetries.computeStabilizerOrbits(domain);
 }
 
+void HighsMipSolverData::startRootRacing(
+    const highs::parallel::TaskGroup& taskGroup,
+    std::vector<std::unique_ptr<RootRacingData>>& racers) {
+  racers.clear();
+  const HighsOptions& options = *mipsolver.options_mip_;
+  HighsInt numRacers = std::min(options.mip_root_racers,
+                                HighsInt{highs::parallel::num_threads() - 1});
+  if (mipsolver.submip || numRacers <= 0) return;
+
+  for (HighsInt k = 1; k <= numRacers; ++k) {
+    racers.emplace_back(new RootRacingData());
+    RootRacingData& racer = *racers.back();
+    // the racers process the root of this model within the current global
+    // domain, so their results transfer without postsolving
+    racer.model = *mipsolver.model_;
+    racer.model.col_lower_ = domain.col_lower_;
+    racer.model.col_upper_ = domain.col_upper_;
+    racer.model.offset_ = 0;
+    racer.solution.value_valid = false;
+    racer.solution.dual_valid = false;
+
+    racer.options = options;
+    racer.options.output_flag = false;
+    racer.options.presolve = kHighsOffString;
+    racer.options.mip_detect_symmetry = false;
+    racer.options.mip_root_racers = 0;
+    racer.options.mip_max_nodes = 1;
+    racer.options.random_seed = options.random_seed + k;
+    racer.options.time_limit -=
+        mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+    racer.options.objective_bound = upper_limit;
+
+    // every other racer solves its first root LP with the interior point
+    // solver, the others keep cuts longer and spend more effort on heuristics
+    if (k % 2 == 1)
+      racer.ipmRootLp = true;
+    else {
+      racer.options.mip_lp_age_limit =
+          std::min(2 * options.mip_lp_age_limit,
+                   HighsInt{std::numeric_limits<int16_t>::max()});
+      racer.options.mip_heuristic_effort =
+          std::min(2 * options.mip_heuristic_effort, 1.0);
+    }
+  }
+
+  for (std::unique_ptr<RootRacingData>& racerData : racers) {
+    RootRacingData* racer = racerData.get();
+    taskGroup.spawn([racer]() {
+      if (racer->ipmRootLp) {
+        Highs ipm;
+        ipm.setOptionValue("solver", "ipm");
+        ipm.setOptionValue("presolve", "off");
+        ipm.setOptionValue("output_flag", false);
+        ipm.setOptionValue("time_limit", racer->options.time_limit);
+        HighsLp lpmodel(racer->model);
+        lpmodel.integrality_.clear();
+        ipm.passModel(std::move(lpmodel));
+        ipm.run();
+        if (ipm.getBasis().valid) racer->rootbasis = ipm.getBasis();
+      }
+
+      racer->solver = std::unique_ptr<HighsMipSolver>(new HighsMipSolver(
+          racer->callback, racer->options, racer->model, racer->solution,
+          true));
+      if (racer->rootbasis.valid) racer->solver->rootbasis = &racer->rootbasis;
+      racer->solver->run();
+    });
+  }
+}
+
+bool HighsMipSolverData::finishRootRacing(
+    std::vector<std::unique_ptr<RootRacingData>>& racers) {
+  // the racers are spawned before all other root tasks, so the caller has
+  // already waited for them when this is called
+  HighsInt numCuts = 0;
+  HighsInt numBoundChanges = 0;
+  std::vector<HighsInt> cutinds;
+  std::vector<double> cutvals;
+  for (const std::unique_ptr<RootRacingData>& racer : racers) {
+    // racers that were cancelled before they started have no solver
+    if (!racer->solver || !racer->solver->mipdata_) continue;
+    const HighsMipSolver& racesolver = *racer->solver;
+    const HighsMipSolverData& racedata = *racesolver.mipdata_;
+
+    if (!racesolver.solution_.empty()) trySolution(racesolver.solution_, 'X');
+
+    // a racer that finished its root proves that no solution better than the
+    // incumbent exists beyond its dual bound
+    if (racesolver.modelstatus_ == HighsModelStatus::kOptimal ||
+        racesolver.modelstatus_ == HighsModelStatus::kInfeasible) {
+      lower_bound =
+          std::max(lower_bound, std::min(racedata.lower_bound, upper_bound));
+      continue;
+    }
+
+    for (HighsInt col = 0; col != mipsolver.numCol(); ++col) {
+      if (racedata.domain.col_lower_[col] > domain.col_lower_[col]) {
+        domain.changeBound(HighsBoundType::kLower, col,
+                           racedata.domain.col_lower_[col],
+                           HighsDomain::Reason::unspecified());
+        ++numBoundChanges;
+      }
+      if (racedata.domain.col_upper_[col] < domain.col_upper_[col]) {
+        domain.changeBound(HighsBoundType::kUpper, col,
+                           racedata.domain.col_upper_[col],
+                           HighsDomain::Reason::unspecified());
+        ++numBoundChanges;
+      }
+      if (domain.infeasible()) break;
+    }
+    if (domain.infeasible()) break;
+
+    const HighsCutPool& racepool = racedata.cutpool;
+    for (HighsInt cut = 0; cut != racepool.getMatrix().getNumRows(); ++cut) {
+      HighsInt cutlen;
+      const HighsInt* inds;
+      const double* vals;
+      racepool.getCut(cut, cutlen, inds, vals);
+      // deleted rows of the pool have an empty range
+      if (cutlen <= 0) continue;
+      cutinds.assign(inds, inds + cutlen);
+      cutvals.assign(vals, vals + cutlen);
+      if (cutpool.addCut(mipsolver, cutinds.data(), cutvals.data(), cutlen,
+                         racepool.getRhs()[cut],
+                         racepool.cutIsIntegral(cut)) != -1)
+        ++numCuts;
+    }
+  }
+  racers.clear();
+
+  if (domain.infeasible()) lower_bound = std::min(kHighsInf, upper_bound);
+  if (lower_bound > upper_limit || lower_bound == kHighsInf) {
+    // the racers decided the root node
+    pruned_treeweight = 1.0;
+    num_nodes += 1;
+    num_leaves += 1;
+  }
+
+  highsLogDev(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+              "Root racing added %" HIGHSINT_FORMAT
+              " cuts and %" HIGHSINT_FORMAT " global bound changes\n",
+              numCuts, numBoundChanges);
+
+  return numCuts != 0 || numBoundChanges != 0;
+}
+
 double HighsMipSolverData::computeNewUpperLimit(double ub, double mip_abs_gap,
                                                 double mip_rel_gap) const {
   double new_upper_limit;
@@ -367,6 +518,7 @@ void HighsMipSolverData::init() {
   num_leaves = 0;
   num_leaves_before_run = 0;
   total_lp_iterations = 0;
+  work_count = 0;
   heuristic_lp_iterations = 0;
   sepa_lp_iterations = 0;
   sb_lp_iterations = 0;
@@ -462,6 +614,7 @@ void HighsMipSolverData::runSetup() {
   pseudocost = HighsPseudocost(mipsolver);
   nodequeue.setNumCol(mipsolver.numCol());
   nodequeue.setOptimalityLimit(optimality_limit);
+  nodequeue.setMemoryLimit(mipsolver.options_mip_->mip_node_memory_limit);
 
   continuous_cols.clear();
   integer_cols.clear();
@@ -884,6 +1037,10 @@ double HighsMipSolverData::percentageInactiveIntegers() const {
 }
 
 void HighsMipSolverData::performRestart() {
+  // the solution of a concurrent sub-MIP is in the space of the current
+  // presolved model
+  heuristics.finishConcurrentLns();
+
   HighsBasis root_basis;
   HighsPseudocostInitialization pscostinit(
       pseudocost, mipsolver.options_mip_->mip_pscost_minreliable,
@@ -894,6 +1051,8 @@ void HighsMipSolverData::performRestart() {
   num_leaves_before_run = num_leaves;
   num_nodes_before_run = num_nodes;
   num_nodes_before_run = num_nodes;
+  treeSizeEstimator.reset(num_nodes, num_leaves,
+                          mipsolver.timer_.read(mipsolver.timer_.solve_clock));
   total_lp_iterations_before_run = total_lp_iterations;
   heuristic_lp_iterations_before_run = heuristic_lp_iterations;
   sepa_lp_iterations_before_run = sepa_lp_iterations;
@@ -1011,6 +1170,7 @@ bool HighsMipSolverData::addIncumbent(const std::vector<double>& sol,
     if (solobj >= upper_bound) return false;
     upper_bound = solobj;
     incumbent = sol;
+    addToSolutionPool(mipsolver.solution_objective_, mipsolver.solution_);
     double new_upper_limit = computeNewUpperLimit(solobj, 0.0, 0.0);
 
     if (!mipsolver.submip) saveReportMipSolution(new_upper_limit);
@@ -1039,12 +1199,63 @@ bool HighsMipSolverData::addIncumbent(const std::vector<double>& sol,
       pruned_treeweight += nodequeue.performBounding(upper_limit);
       printDisplayLine(source);
     }
-  } else if (incumbent.empty())
-    incumbent = sol;
+  } else {
+    if (incumbent.empty()) incumbent = sol;
+    // a solution that does not improve the incumbent is only postsolved if
+    // it is among the best solutions of the pool
+    if (solutionPoolAccepts(solobj)) {
+      HighsSolution solution;
+      solution.col_value = sol;
+      solution.value_valid = true;
+      postSolveStack.undoPrimal(*mipsolver.options_mip_, solution);
+      HighsCDouble obj = mipsolver.orig_model_->offset_;
+      for (HighsInt i = 0; i != mipsolver.orig_model_->num_col_; ++i)
+        obj += mipsolver.orig_model_->col_cost_[i] * solution.col_value[i];
+      addToSolutionPool(double(obj), solution.col_value);
+    }
+  }
 
   return true;
 }
 
+bool HighsMipSolverData::solutionPoolAccepts(double solobj) const {
+  const size_t poolSize = mipsolver.options_mip_->mip_solution_pool_size;
+  if (mipsolver.submip || poolSize == 0) return false;
+  if (solutionPool.size() < poolSize) return true;
+  // the objective of the worst solution in the space of the presolved model
+  double worstobj =
+      solutionPool.back().objective * (int)mipsolver.orig_model_->sense_ -
+      mipsolver.model_->offset_;
+  return solobj < worstobj;
+}
+
+void HighsMipSolverData::addToSolutionPool(double objective,
+                                           const std::vector<double>& sol) {
+  const size_t poolSize = mipsolver.options_mip_->mip_solution_pool_size;
+  if (mipsolver.submip || poolSize == 0) return;
+
+  // solutions of the same objective are kept in the order they were found
+  const int sense = (int)mipsolver.orig_model_->sense_;
+  auto pos = solutionPool.begin();
+  while (pos != solutionPool.end() &&
+         pos->objective * sense <= objective * sense)
+    ++pos;
+  if (size_t(pos - solutionPool.begin()) >= poolSize) return;
+
+  for (const HighsObjectiveSolution& poolsol : solutionPool) {
+    bool same = true;
+    for (size_t i = 0; i < sol.size() && same; ++i)
+      same = std::abs(poolsol.col_value[i] - sol[i]) <= feastol;
+    if (same) return;
+  }
+
+  HighsObjectiveSolution record;
+  record.objective = objective;
+  record.col_value = sol;
+  solutionPool.insert(pos, std::move(record));
+  if (solutionPool.size() > poolSize) solutionPool.pop_back();
+}
+
 static std::array<char, 16> convertToPrintString(int64_t val) {
   double l = std::log10(std::max(1.0, double(val)));
   std::array<char, 16> printString;
@@ -1112,6 +1323,10 @@ void HighsMipSolverData::printDisplayLine(char first) {
   // printed, the sense of the optimizaiton is applied so that the
   // values printed correspond to the original objective.
 
+  // the estimates are updated also when logging is off, so that they are
+  // available in the solver info
+  updateTreeSizeEstimate();
+
   // No point in computing all the logging values if logging is off
   bool output_flag = *mipsolver.options_mip_->log_options.output_flag;
   if (!output_flag) return;
@@ -1349,8 +1564,11 @@ void HighsMipSolverData::evaluateRootNode() {
     maxSepaRounds =
         std::min(HighsInt(2 * std::sqrt(maxTreeSizeLog2)), maxSepaRounds);
   std::unique_ptr<SymmetryDetectionData> symData;
+  std::vector<std::unique_ptr<RootRacingData>> racers;
   highs::parallel::TaskGroup tg;
 restart:
+  // the racers must be spawned first as they are the last tasks to be synced
+  startRootRacing(tg, racers);
   if (detectSymmetries) startSymmetryDetection(tg, symData);
   if (!analyticCenterComputed) startAnalyticCenterComputation(tg);
 
@@ -1442,6 +1660,8 @@ restart:
                    "\n%.1f%% inactive integer columns, restarting\n",
                    fixingRate);
       tg.taskWait();
+      finishRootRacing(racers);
+      if (lower_bound > upper_limit || lower_bound == kHighsInf) return;
       performRestart();
       ++numRestartsRoot;
       if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) goto restart;
@@ -1601,6 +1821,13 @@ restart:
     if (upper_limit != kHighsInf && !moreHeuristicsAllowed()) break;
 
     if (checkLimits()) return;
+    // search the neighbourhoods of the infeasible warm start solutions
+    for (const std::vector<double>& sol : warmStartSolutions) {
+      heuristics.RINS(rootlpsol, postSolveStack.getReducedPrimalSolution(sol));
+      heuristics.flushStatistics();
+      if (checkLimits()) return;
+    }
+    warmStartSolutions.clear();
     heuristics.RENS(rootlpsol);
     heuristics.flushStatistics();
 
@@ -1670,6 +1897,8 @@ restart:
                      fixingRate);
         if (stall != -1) maxSepaRounds = std::min(maxSepaRounds, nseparounds);
         tg.taskWait();
+        finishRootRacing(racers);
+        if (lower_bound > upper_limit || lower_bound == kHighsInf) return;
         performRestart();
         ++numRestartsRoot;
         if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) goto restart;
@@ -1684,6 +1913,22 @@ restart:
       if (status == HighsLpRelaxation::Status::kInfeasible) return;
     }
 
+    if (!racers.empty()) {
+      if (checkLimits()) return;
+      tg.taskWait();
+      // continue from the root relaxation with the cuts and bound changes
+      // found by the racers
+      bool separate = finishRootRacing(racers);
+      if (lower_bound > upper_limit || lower_bound == kHighsInf) return;
+      status = evaluateRootLp();
+      if (status == HighsLpRelaxation::Status::kInfeasible) return;
+      if (separate && lp.scaledOptimal(status)) {
+        HighsInt ncuts;
+        if (rootSeparationRound(sepa, ncuts, status)) return;
+        printDisplayLine();
+      }
+    }
+
     // add the root node to the nodequeue to initialize the search
     nodequeue.emplaceNode(std::vector<HighsDomainChange>(),
                           std::vector<HighsInt>(), lower_bound,
@@ -1691,6 +1936,254 @@ restart:
   }
 }
 
+bool HighsMipSolverData::searchSubtreesInParallel() {
+  const HighsOptions& options = *mipsolver.options_mip_;
+  // The subtrees are sent to worker processes when the solve is distributed
+  // and are otherwise searched on the threads of this process. Nodes imported
+  // from the subtree searches carry propagated bound changes that were not
+  // branched on, which invalidates the stabilizers computed for orbital
+  // fixing, so both modes are skipped when permutations were detected.
+  const bool distributed =
+      mipsolver.workers != nullptr && !mipsolver.workers->empty();
+  if ((!distributed && !options.mip_parallel_tree_search) ||
+      mipsolver.submip || symmetries.numPerms != 0)
+    return false;
+
+  HighsInt numSubtrees = (HighsInt)std::min(
+      distributed ? int64_t(mipsolver.workers->size())
+                  : int64_t{highs::parallel::num_threads()},
+      nodequeue.numActiveNodes());
+  if (numSubtrees < (distributed ? 1 : 2)) return false;
+
+  int64_t subtreeNodeLimit = options.mip_subtree_node_limit;
+  if (options.mip_max_nodes != kHighsIInf)
+    subtreeNodeLimit = std::min(
+        subtreeNodeLimit, (options.mip_max_nodes - num_nodes) / numSubtrees);
+  if (subtreeNodeLimit < 1) return false;
+
+  // All subtrees of a round use the same options
+  HighsOptions subtreeoptions = options;
+  setSubtreeOptions(subtreeoptions, subtreeNodeLimit);
+  subtreeoptions.time_limit -=
+      mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+  subtreeoptions.objective_bound = upper_limit;
+
+  std::vector<HighsNodeQueue::OpenNode> nodes;
+  nodes.reserve(numSubtrees);
+  for (HighsInt i = 0; i != numSubtrees; ++i)
+    nodes.emplace_back(nodequeue.popBestBoundNode());
+
+  // the subtree models are the current LP relaxation, including its cuts,
+  // with the global bounds tightened by the domain changes of the node
+  const HighsLp& relaxation = lp.getLp();
+  const HighsBasis& basis = lp.getLpSolver().getBasis();
+  std::vector<HighsLp> subtreeLps(numSubtrees, relaxation);
+  for (HighsInt i = 0; i != numSubtrees; ++i) {
+    HighsLp& sublp = subtreeLps[i];
+    sublp.integrality_ = mipsolver.model_->integrality_;
+    sublp.col_lower_ = domain.col_lower_;
+    sublp.col_upper_ = domain.col_upper_;
+    sublp.offset_ = 0;
+    for (const HighsDomainChange& domchg : nodes[i].domchgstack) {
+      if (domchg.boundtype == HighsBoundType::kLower)
+        sublp.col_lower_[domchg.column] =
+            std::max(domchg.boundval, sublp.col_lower_[domchg.column]);
+      else
+        sublp.col_upper_[domchg.column] =
+            std::min(domchg.boundval, sublp.col_upper_[domchg.column]);
+    }
+  }
+
+  std::vector<HighsSubtreeResult> results(numSubtrees);
+  if (distributed)
+    distributeSubtrees(subtreeoptions, subtreeLps, results);
+  else {
+    std::vector<HighsCallback> subtreeCallbacks(numSubtrees);
+    HighsSolution solution;
+    solution.value_valid = false;
+    solution.dual_valid = false;
+    HighsPseudocostInitialization pscostinit(pseudocost,
+                                             options.mip_pscost_minreliable);
+    std::vector<std::unique_ptr<HighsMipSolver>> subtrees(numSubtrees);
+    for (HighsInt i = 0; i != numSubtrees; ++i) {
+      subtrees[i] = std::unique_ptr<HighsMipSolver>(
+          new HighsMipSolver(subtreeCallbacks[i], subtreeoptions,
+                             subtreeLps[i], solution, true));
+      if (basis.valid) subtrees[i]->rootbasis = &basis;
+      subtrees[i]->pscostinit = &pscostinit;
+      subtrees[i]->clqtableinit = &cliquetable;
+      subtrees[i]->implicinit = &implications;
+    }
+
+    // The workers only read from this solver's data until all of them are
+    // finished. With the fixed node limit each subtree search is independent
+    // of the thread timing, and the results are merged in the order of the
+    // nodes, which keeps the search deterministic.
+    highs::parallel::for_each(
+        0, numSubtrees,
+        [&](HighsInt start, HighsInt end) {
+          for (HighsInt i = start; i != end; ++i) {
+            subtrees[i]->run();
+            assert(subtrees[i]->numCol() == mipsolver.numCol());
+            results[i].extract(*subtrees[i]);
+          }
+        },
+        1);
+  }
+
+  for (HighsInt i = 0; i != numSubtrees; ++i) {
+    HighsNodeQueue::OpenNode& node = nodes[i];
+    if (results[i].valid)
+      mergeSubtree(node, subtreeLps[i], results[i]);
+    else
+      // the worker was lost, the node is searched again later
+      pruned_treeweight += nodequeue.emplaceNode(
+          std::move(node.domchgstack), std::move(node.branchings),
+          node.lower_bound, node.estimate, node.depth);
+  }
+
+  return true;
+}
+
+void HighsMipSolverData::distributeSubtrees(
+    const HighsOptions& subtreeoptions, std::vector<HighsLp>& subtreeLps,
+    std::vector<HighsSubtreeResult>& results) {
+  std::vector<std::shared_ptr<HighsMipTransport>>& workers =
+      *mipsolver.workers;
+  const HighsBasis& basis = lp.getLpSolver().getBasis();
+  HighsInt numSubtrees = subtreeLps.size();
+
+  // All tasks are sent before the first result is awaited so that the
+  // workers search concurrently. Each worker receives one subtree per round
+  // and the open nodes it returns are put back into the node queue, from
+  // which the best bound nodes are split among the workers again in the next
+  // round. The results are merged in the order of the nodes, so the search is
+  // deterministic for a fixed number of workers.
+  std::vector<char> message;
+  std::vector<uint8_t> sent(numSubtrees);
+  for (HighsInt i = 0; i != numSubtrees; ++i) {
+    subtreeLps[i].a_matrix_.ensureColwise();
+    writeSubtreeTask(message, subtreeLps[i], basis, subtreeoptions);
+    sent[i] = workers[i]->send(message);
+  }
+
+  for (HighsInt i = 0; i != numSubtrees; ++i) {
+    if (sent[i] && workers[i]->receive(message) &&
+        results[i].read(message, mipsolver.numCol()))
+      continue;
+
+    results[i].valid = false;
+    highsLogUser(mipsolver.options_mip_->log_options, HighsLogType::kWarning,
+                 "Lost MIP worker %d, continuing without it\n", int(i));
+    workers[i] = nullptr;
+  }
+
+  workers.erase(std::remove(workers.begin(), workers.end(), nullptr),
+                workers.end());
+}
+
+void HighsMipSolverData::mergeSubtree(HighsNodeQueue::OpenNode& node,
+                                      const HighsLp& sublp,
+                                      HighsSubtreeResult& result) {
+  num_nodes += result.num_nodes;
+  num_leaves += result.num_leaves;
+  total_lp_iterations += result.lp_iterations;
+
+  if (!result.solution.empty()) trySolution(result.solution, 'W');
+
+  if (result.model_status == HighsModelStatus::kOptimal ||
+      result.model_status == HighsModelStatus::kInfeasible ||
+      (result.open_nodes.empty() &&
+       result.lower_bound >= result.upper_bound)) {
+    pruned_treeweight += std::ldexp(1.0, 1 - node.depth);
+    return;
+  }
+
+  if (result.open_nodes.empty()) {
+    // the search was interrupted before the root of the subtree was
+    // branched on
+    pruned_treeweight += nodequeue.emplaceNode(
+        std::move(node.domchgstack), std::move(node.branchings),
+        std::max(node.lower_bound, result.lower_bound), node.estimate,
+        node.depth);
+    return;
+  }
+
+  // the open nodes of the subtree are stored relative to the global domain
+  // of the worker, so the node's domain changes and the bounds tightened by
+  // the worker are prepended to each of them. The node queue requires at
+  // most one change per column and bound type, hence changes for a column
+  // that is already in the stack tighten the existing entry instead.
+  std::vector<HighsInt> lowerPos(mipsolver.numCol(), -1);
+  std::vector<HighsInt> upperPos(mipsolver.numCol(), -1);
+  auto addDomchg = [&](std::vector<HighsDomainChange>& domchgstack,
+                       const HighsDomainChange& domchg) {
+    HighsInt& pos = domchg.boundtype == HighsBoundType::kLower
+                        ? lowerPos[domchg.column]
+                        : upperPos[domchg.column];
+    if (pos == -1) {
+      pos = domchgstack.size();
+      domchgstack.push_back(domchg);
+      return true;
+    }
+    if (domchg.boundtype == HighsBoundType::kLower)
+      domchgstack[pos].boundval =
+          std::max(domchg.boundval, domchgstack[pos].boundval);
+    else
+      domchgstack[pos].boundval =
+          std::min(domchg.boundval, domchgstack[pos].boundval);
+    return false;
+  };
+  auto resetPositions = [&](const std::vector<HighsDomainChange>& domchgs) {
+    for (const HighsDomainChange& domchg : domchgs) {
+      if (domchg.boundtype == HighsBoundType::kLower)
+        lowerPos[domchg.column] = -1;
+      else
+        upperPos[domchg.column] = -1;
+    }
+  };
+
+  std::vector<HighsDomainChange> subtreeDomchgs;
+  for (const HighsDomainChange& domchg : node.domchgstack)
+    addDomchg(subtreeDomchgs, domchg);
+  for (HighsInt col = 0; col != mipsolver.numCol(); ++col) {
+    if (result.col_lower[col] > sublp.col_lower_[col])
+      addDomchg(subtreeDomchgs, HighsDomainChange{result.col_lower[col], col,
+                                                  HighsBoundType::kLower});
+    if (result.col_upper[col] < sublp.col_upper_[col])
+      addDomchg(subtreeDomchgs, HighsDomainChange{result.col_upper[col], col,
+                                                  HighsBoundType::kUpper});
+  }
+  resetPositions(subtreeDomchgs);
+
+  HighsCDouble subtreeWeight = std::ldexp(1.0, 1 - node.depth);
+  for (HighsSubtreeResult::OpenNode& subnode : result.open_nodes) {
+    std::vector<HighsDomainChange> domchgstack;
+    for (const HighsDomainChange& domchg : subtreeDomchgs)
+      addDomchg(domchgstack, domchg);
+    std::vector<HighsInt> branchings = node.branchings;
+    HighsInt numBranchings = subnode.branchings.size();
+    HighsInt k = 0;
+    for (HighsInt j = 0; j != (HighsInt)subnode.domchgstack.size(); ++j) {
+      bool added = addDomchg(domchgstack, subnode.domchgstack[j]);
+      while (k != numBranchings && subnode.branchings[k] < j) ++k;
+      if (added && k != numBranchings && subnode.branchings[k] == j)
+        branchings.push_back(domchgstack.size() - 1);
+    }
+    resetPositions(domchgstack);
+
+    HighsInt depth = node.depth + subnode.depth - 1;
+    subtreeWeight -= std::ldexp(1.0, 1 - depth);
+    pruned_treeweight += nodequeue.emplaceNode(
+        std::move(domchgstack), std::move(branchings), subnode.lower_bound,
+        subnode.estimate, depth);
+  }
+
+  // the remaining weight belongs to the part of the subtree that the worker
+  // has pruned
+  pruned_treeweight += subtreeWeight;
+}
+
 bool HighsMipSolverData::checkLimits(int64_t nodeOffset) const {
   const HighsOptions& options = *mipsolver.options_mip_;
 
@@ -1738,6 +2231,15 @@ bool HighsMipSolverData::checkLimits(int64_t nodeOffset) const {
     }
   }
 
+  if (work_count >= options.work_limit) {
+    if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
+      highsLogDev(options.log_options, HighsLogType::kInfo,
+                  "Reached work limit\n");
+      mipsolver.modelstatus_ = HighsModelStatus::kWorkLimit;
+    }
+    return true;
+  }
+
   if (options.mip_max_nodes != kHighsIInf &&
       num_nodes + nodeOffset >= options.mip_max_nodes) {
     if (mipsolver.modelstatus_ == HighsModelStatus::kNotset) {
@@ -1848,6 +2350,13 @@ void HighsMipSolverData::saveReportMipSolution(const double new_upper_limit) {
     record.col_value = mipsolver.solution_;
     mipsolver.saved_objective_and_solution_.push_back(record);
   }
+  // keep the most recent improving solutions for warm starting a related
+  // solve
+  if (improvingSolutions.size() == kMaxWarmStartSolutions)
+    improvingSolutions.erase(improvingSolutions.begin());
+  improvingSolutions.emplace_back();
+  improvingSolutions.back().objective = mipsolver.solution_objective_;
+  improvingSolutions.back().col_value = mipsolver.solution_;
   FILE* file = mipsolver.improving_solution_file_;
   if (file) {
     writeLpObjective(file, *(mipsolver.orig_model_), mipsolver.solution_);
@@ -1857,6 +2366,128 @@ void HighsMipSolverData::saveReportMipSolution(const double new_upper_limit) {
   }
 }
 
+void HighsMipSolverData::importWarmStart(const HighsMipWarmStart& warmstart) {
+  const HighsInt origNumCol = mipsolver.orig_model_->num_col_;
+
+  // solutions that are feasible for this model update the incumbent, the
+  // others define neighbourhoods for RINS at the root node
+  HighsInt numFeasible = 0;
+  for (const HighsObjectiveSolution& sol : warmstart.solutions) {
+    if ((HighsInt)sol.col_value.size() != origNumCol) continue;
+    if (trySolution(postSolveStack.getReducedPrimalSolution(sol.col_value),
+                    'I'))
+      ++numFeasible;
+    else if (warmStartSolutions.size() < kMaxWarmStartSolutions)
+      warmStartSolutions.push_back(sol.col_value);
+  }
+
+  // cuts and conflicts are only valid for solutions below the objective
+  // cutoff of the solve they were derived in, with the global domain that
+  // may have been tightened by reduced cost fixing and dual arguments in
+  // presolve. Hence they are only used for the same model and when the
+  // incumbent of that solve is feasible, so that the cutoff is reproduced.
+  bool sameModel = warmstart.model_hash ==
+                   HighsMipCheckpoint::modelHash(*mipsolver.orig_model_);
+  bool bestSolutionFeasible = false;
+  if (!warmstart.solutions.empty() && !incumbent.empty()) {
+    double bestobj =
+        warmstart.solutions[0].objective * (int)mipsolver.orig_model_->sense_ -
+        mipsolver.model_->offset_;
+    bestSolutionFeasible =
+        upper_bound <= bestobj + feastol * std::max(1.0, std::abs(bestobj));
+  }
+
+  HighsInt numCuts = 0;
+  HighsInt numConflicts = 0;
+  if (sameModel && bestSolutionFeasible && mipsolver.numCol() != 0) {
+    // map the columns of the original model to the columns of the reduced
+    // model whose values are the original values
+    std::vector<HighsInt> reducedColIndex(origNumCol, -1);
+    std::vector<uint8_t> transformedOrigCols =
+        postSolveStack.getTransformedOrigCols();
+    for (HighsInt i = 0; i != mipsolver.numCol(); ++i) {
+      HighsInt origCol = postSolveStack.getOrigColIndex(i);
+      if (!transformedOrigCols[origCol]) reducedColIndex[origCol] = i;
+    }
+
+    auto mapColumns = [&](const std::vector<HighsInt>& origIndex,
+                          HighsInt start, HighsInt end,
+                          std::vector<HighsInt>& index) {
+      index.clear();
+      for (HighsInt j = start; j != end; ++j) {
+        HighsInt origCol = origIndex[j];
+        if (origCol < 0 || origCol >= origNumCol) return false;
+        if (reducedColIndex[origCol] == -1) return false;
+        index.push_back(reducedColIndex[origCol]);
+      }
+      return true;
+    };
+
+    std::vector<HighsInt> cutIndex;
+    std::vector<double> cutValue;
+    HighsInt numWarmStartCuts = (HighsInt)warmstart.cut_start.size() - 1;
+    for (HighsInt i = 0; i < numWarmStartCuts; ++i) {
+      HighsInt start = warmstart.cut_start[i];
+      HighsInt end = warmstart.cut_start[i + 1];
+      if (!mapColumns(warmstart.cut_index, start, end, cutIndex)) continue;
+      cutValue.assign(warmstart.cut_value.begin() + start,
+                      warmstart.cut_value.begin() + end);
+
+      // do not use cuts that are violated by the incumbent
+      if (!incumbent.empty()) {
+        HighsCDouble activity = 0.0;
+        for (HighsInt j = 0; j != end - start; ++j)
+          activity += cutValue[j] * incumbent[cutIndex[j]];
+        if (double(activity) > warmstart.cut_upper[i] + feastol) continue;
+      }
+
+      if (cutpool.addCut(mipsolver, cutIndex.data(), cutValue.data(),
+                         end - start, warmstart.cut_upper[i], false, true,
+                         false) != -1)
+        ++numCuts;
+    }
+
+    std::vector<HighsDomainChange> conflict;
+    HighsInt numWarmStartConflicts =
+        (HighsInt)warmstart.conflict_start.size() - 1;
+    for (HighsInt i = 0; i < numWarmStartConflicts; ++i) {
+      HighsInt start = warmstart.conflict_start[i];
+      HighsInt end = warmstart.conflict_start[i + 1];
+      if (!mapColumns(warmstart.conflict_index, start, end, cutIndex)) continue;
+
+      // do not use conflicts whose bound changes all hold for the incumbent
+      bool incumbentInConflict = !incumbent.empty();
+      conflict.clear();
+      for (HighsInt j = start; j != end; ++j) {
+        HighsInt col = cutIndex[j - start];
+        double boundval = warmstart.conflict_value[j];
+        if (warmstart.conflict_is_lower[j]) {
+          conflict.push_back(
+              HighsDomainChange{boundval, col, HighsBoundType::kLower});
+          incumbentInConflict =
+              incumbentInConflict && incumbent[col] >= boundval - feastol;
+        } else {
+          conflict.push_back(
+              HighsDomainChange{boundval, col, HighsBoundType::kUpper});
+          incumbentInConflict =
+              incumbentInConflict && incumbent[col] <= boundval + feastol;
+        }
+      }
+      if (incumbentInConflict) continue;
+
+      conflictPool.addConflictCut(conflict);
+      ++numConflicts;
+    }
+  }
+
+  highsLogUser(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+               "MIP warm start: %" HIGHSINT_FORMAT " of %" HIGHSINT_FORMAT
+               " solutions feasible, %" HIGHSINT_FORMAT
+               " cuts and %" HIGHSINT_FORMAT " conflicts imported%s\n",
+               numFeasible, (HighsInt)warmstart.solutions.size(), numCuts,
+               numConflicts, sameModel ? "" : " (model changed)");
+}
+
 void HighsMipSolverData::limitsToBounds(double& dual_bound,
                                         double& primal_bound,
                                         double& mip_rel_gap) const {
@@ -1889,6 +2520,16 @@ void HighsMipSolverData::limitsToBounds(double& dual_bound,
   }
 }
 
+void HighsMipSolverData::updateTreeSizeEstimate() {
+  double dual_bound;
+  double primal_bound;
+  double mip_rel_gap;
+  limitsToBounds(dual_bound, primal_bound, mip_rel_gap);
+  treeSizeEstimator.update(num_nodes, num_leaves, double(pruned_treeweight),
+                           mip_rel_gap,
+                           mipsolver.timer_.read(mipsolver.timer_.solve_clock));
+}
+
 bool HighsMipSolverData::interruptFromCallbackWithData(
     const int callback_type, const std::string message) const {
   if (!mipsolver.callback_->callbackActive(callback_type)) return false;
@@ -1906,5 +2547,17 @@ bool HighsMipSolverData::interruptFromCallbackWithData(
   mipsolver.callback_->data_out.mip_primal_bound = primal_bound;
   mipsolver.callback_->data_out.mip_dual_bound = dual_bound;
   mipsolver.callback_->data_out.mip_gap = mip_rel_gap;
+  mipsolver.callback_->data_out.mip_tree_weight =
+      treeSizeEstimator.getTreeWeight();
+  mipsolver.callback_->data_out.mip_remaining_nodes =
+      treeSizeEstimator.getRemainingNodes();
+  mipsolver.callback_->data_out.mip_remaining_nodes_backtrack =
+      treeSizeEstimator.getRemainingNodesBacktrack();
+  mipsolver.callback_->data_out.mip_remaining_nodes_tree_weight =
+      treeSizeEstimator.getRemainingNodesTreeWeight();
+  mipsolver.callback_->data_out.mip_remaining_nodes_gap =
+      treeSizeEstimator.getRemainingNodesGap();
+  mipsolver.callback_->data_out.mip_remaining_time =
+      treeSizeEstimator.getRemainingTime();
   return mipsolver.callback_->callbackAction(callback_type, message);
 }
@@ -12,6 +12,7 @@
 #ifndef HIGHS_MIP_SOLVER_DATA_H_
 #define HIGHS_MIP_SOLVER_DATA_H_
 
+#include <atomic>
 #include <vector>
 
 #include "mip/HighsCliqueTable.h"
@@ -21,6 +22,7 @@
 #include "mip/HighsDomain.h"
 #include "mip/HighsImplications.h"
 #include "mip/HighsLpRelaxation.h"
+#include "mip/HighsMipDistributed.h"
 #include "mip/HighsNodeQueue.h"
 #include "mip/HighsObjectiveFunction.h"
 #include "mip/HighsPrimalHeuristics.h"
@@ -28,6 +30,7 @@
 #include "mip/HighsRedcostFixing.h"
 #include "mip/HighsSearch.h"
 #include "mip/HighsSeparation.h"
+#include "mip/HighsTreeSizeEstimator.h"
 #include "parallel/HighsParallel.h"
 #include "presolve/HighsPostsolveStack.h"
 #include "presolve/HighsSymmetry.h"
@@ -87,6 +90,7 @@ struct HighsMipSolverData {
   HighsInt maxTreeSizeLog2;
 
   HighsCDouble pruned_treeweight;
+  HighsTreeSizeEstimator treeSizeEstimator;
   double avgrootlpiters;
   double last_disptime;
   int64_t firstrootlpiters;
@@ -95,6 +99,9 @@ struct HighsMipSolverData {
   int64_t num_leaves_before_run;
   int64_t num_nodes_before_run;
   int64_t total_lp_iterations;
+  // deterministic work of the LP solves, the propagation, the separation and
+  // the sub-MIPs, which parallel tasks add to concurrently
+  std::atomic<int64_t> work_count;
   int64_t heuristic_lp_iterations;
   int64_t sepa_lp_iterations;
   int64_t sb_lp_iterations;
@@ -110,6 +117,13 @@ struct HighsMipSolverData {
   double upper_limit;
   double optimality_limit;
   std::vector<double> incumbent;
+  // the most recent improving solutions and the solutions of a warm start
+  // that are not feasible, both in the space of the original model
+  std::vector<HighsObjectiveSolution> improvingSolutions;
+  std::vector<std::vector<double>> warmStartSolutions;
+  // the best distinct feasible solutions in the order of decreasing quality
+  // and in the space of the original model
+  std::vector<HighsObjectiveSolution> solutionPool;
 
   HighsNodeQueue nodequeue;
 
@@ -149,6 +163,20 @@ struct HighsMipSolverData {
   void finishSymmetryDetection(const highs::parallel::TaskGroup& taskGroup,
                                std::unique_ptr<SymmetryDetectionData>& symData);
 
+  struct RootRacingData {
+    HighsOptions options;
+    HighsLp model;
+    HighsCallback callback;
+    HighsSolution solution;
+    HighsBasis rootbasis;
+    bool ipmRootLp = false;
+    std::unique_ptr<HighsMipSolver> solver;
+  };
+
+  void startRootRacing(const highs::parallel::TaskGroup& taskGroup,
+                       std::vector<std::unique_ptr<RootRacingData>>& racers);
+  bool finishRootRacing(std::vector<std::unique_ptr<RootRacingData>>& racers);
+
   double computeNewUpperLimit(double upper_bound, double mip_abs_gap,
                               double mip_rel_gap) const;
   bool moreHeuristicsAllowed() const;
@@ -159,6 +187,9 @@ struct HighsMipSolverData {
   void runPresolve();
   void setupDomainPropagation();
   void saveReportMipSolution(const double new_upper_limit);
+  void importWarmStart(const HighsMipWarmStart& warmstart);
+  bool solutionPoolAccepts(double solobj) const;
+  void addToSolutionPool(double objective, const std::vector<double>& sol);
   void runSetup();
   double transformNewIncumbent(const std::vector<double>& sol);
   double percentageInactiveIntegers() const;
@@ -169,6 +200,12 @@ struct HighsMipSolverData {
                            HighsLpRelaxation::Status& status);
   HighsLpRelaxation::Status evaluateRootLp();
   void evaluateRootNode();
+  bool searchSubtreesInParallel();
+  void distributeSubtrees(const HighsOptions& subtreeoptions,
+                          std::vector<HighsLp>& subtreeLps,
+                          std::vector<HighsSubtreeResult>& results);
+  void mergeSubtree(HighsNodeQueue::OpenNode& node, const HighsLp& sublp,
+                    HighsSubtreeResult& result);
   bool addIncumbent(const std::vector<double>& sol, double solobj, char source);
 
   const std::vector<double>& getSolution() const;
@@ -184,6 +221,14 @@ struct HighsMipSolverData {
   }
 
   bool checkLimits(int64_t nodeOffset = 0) const;
+
+  void addWork(int64_t work) {
+    work_count.fetch_add(work, std::memory_order_relaxed);
+  }
+
+  /// updates the estimates of the remaining size of the search tree
+  void updateTreeSizeEstimate();
+
   void limitsToBounds(double& dual_bound, double& primal_bound,
                       double& mip_rel_gap) const;
   bool interruptFromCallbackWithData(const int callback_type,
@@ -16,6 +16,7 @@
 #include <unordered_set>
 
 #include "mip/HighsCutGeneration.h"
+#include "mip/HighsGF2Solve.h"
 #include "mip/HighsGFkSolve.h"
 #include "mip/HighsLpAggregator.h"
 #include "mip/HighsLpRelaxation.h"
@@ -43,6 +44,29 @@ static bool separateModKCuts(const std::vector<int64_t>& intSystemValue,
   return cutpool.getNumCuts() != numCuts;
 }
 
+template <typename FoundModKCut>
+static bool separateMod2Cuts(const std::vector<int64_t>& intSystemValue,
+                             const std::vector<HighsInt>& intSystemIndex,
+                             const std::vector<HighsInt>& intSystemStart,
+                             const HighsCutPool& cutpool, HighsInt numCol,
+                             FoundModKCut&& foundModKCut) {
+  // use the elimination on bit-packed rows if the system is small enough
+  HighsInt numSystemCols = intSystemStart.size() - 1;
+  if (!HighsGF2Solve::fitsDense(numCol + 1, numSystemCols))
+    return separateModKCuts<2>(intSystemValue, intSystemIndex, intSystemStart,
+                               cutpool, numCol, foundModKCut);
+
+  HighsGF2Solve GF2Solve;
+
+  HighsInt numCuts = cutpool.getNumCuts();
+
+  GF2Solve.fromCSC(intSystemValue, intSystemIndex, intSystemStart, numCol + 1);
+  GF2Solve.setRhs(numCol, 1);
+  GF2Solve.solve(foundModKCut);
+
+  return cutpool.getNumCuts() != numCuts;
+}
+
 void HighsModkSeparator::separateLpSolution(HighsLpRelaxation& lpRelaxation,
                                             HighsLpAggregator& lpAggregator,
                                             HighsTransformedLp& transLp,
@@ -249,8 +273,8 @@ void HighsModkSeparator::separateLpSolution(HighsLpRelaxation& lpRelaxation,
   };
 
   k = 2;
-  if (separateModKCuts<2>(intSystemValue, intSystemIndex, intSystemStart,
-                          cutpool, lp.num_col_, foundCut))
+  if (separateMod2Cuts(intSystemValue, intSystemIndex, intSystemStart, cutpool,
+                       lp.num_col_, foundCut))
     return;
 
   usedWeights.clear();
@@ -61,7 +61,7 @@ class HighsNodeQueue::NodeLowerRbTree : public CacheMinRbTree<NodeLowerRbTree> {
   }
   std::tuple<double, HighsInt, double, int64_t> getKey(HighsInt node) const {
     return std::make_tuple(nodeQueue->nodes[node].lower_bound,
-                           HighsInt(nodeQueue->nodes[node].domchgstack.size()),
+                           nodeQueue->nodes[node].domchgStackSize(),
                            nodeQueue->nodes[node].estimate, node);
   }
 };
@@ -87,7 +87,7 @@ class HighsNodeQueue::NodeHybridEstimRbTree
     constexpr double kEstimWeight = 0.5;
     return std::make_tuple(kLbWeight * nodeQueue->nodes[node].lower_bound +
                                kEstimWeight * nodeQueue->nodes[node].estimate,
-                           -HighsInt(nodeQueue->nodes[node].domchgstack.size()),
+                           -nodeQueue->nodes[node].domchgStackSize(),
                            node);
   }
 };
@@ -156,6 +156,7 @@ void HighsNodeQueue::link_domchgs(int64_t node) {
   assert(node != -1);
   HighsInt numchgs = nodes[node].domchgstack.size();
   nodes[node].domchglinks.resize(numchgs);
+  numLinkedDomchgs += numchgs;
 
   for (HighsInt i = 0; i != numchgs; ++i) {
     double val = nodes[node].domchgstack[i].boundval;
@@ -174,7 +175,8 @@ void HighsNodeQueue::link_domchgs(int64_t node) {
 
 void HighsNodeQueue::unlink_domchgs(int64_t node) {
   assert(node != -1);
-  HighsInt numchgs = nodes[node].domchgstack.size();
+  HighsInt numchgs = nodes[node].domchglinks.size();
+  numLinkedDomchgs -= numchgs;
 
   for (HighsInt i = 0; i != numchgs; ++i) {
     HighsInt col = nodes[node].domchgstack[i].column;
@@ -214,9 +216,108 @@ void HighsNodeQueue::unlink(int64_t node) {
     unlink_lower(node);
   }
   unlink_domchgs(node);
+  if (nodes[node].spillPos != -1) {
+    // the node is pruned while spilled, its data in the file is abandoned
+    nodes[node].spillPos = -1;
+    --numSpilled;
+    if (numSpilled == 0) spillFileSize = 0;
+  }
   freeslots.push(node);
 }
 
+bool HighsNodeQueue::spill(int64_t node) {
+  OpenNode& openNode = nodes[node];
+  assert(openNode.spillPos == -1);
+  if (!spillFile) {
+    spillFile = decltype(spillFile)(std::tmpfile());
+    if (!spillFile) return false;
+  }
+
+  HighsInt numDomchgs = openNode.domchgstack.size();
+  HighsInt numBranchings = openNode.branchings.size();
+  if (std::fseek(spillFile.get(), spillFileSize, SEEK_SET) != 0 ||
+      std::fwrite(openNode.domchgstack.data(), sizeof(HighsDomainChange),
+                  numDomchgs, spillFile.get()) != size_t(numDomchgs) ||
+      std::fwrite(openNode.branchings.data(), sizeof(HighsInt), numBranchings,
+                  spillFile.get()) != size_t(numBranchings))
+    return false;
+
+  // the node is not visible in the column-wise node sets while it is spilled,
+  // which only means that it is not considered when nodes are pruned because
+  // of global bound changes or when the open nodes are counted for branching
+  unlink_domchgs(node);
+  openNode.spillPos = spillFileSize;
+  openNode.numSpilledDomchgs = numDomchgs;
+  openNode.numSpilledBranchings = numBranchings;
+  spillFileSize += sizeof(HighsDomainChange) * numDomchgs +
+                   sizeof(HighsInt) * numBranchings;
+  std::vector<HighsDomainChange>().swap(openNode.domchgstack);
+  std::vector<HighsInt>().swap(openNode.branchings);
+  ++numSpilled;
+
+  return true;
+}
+
+bool HighsNodeQueue::readSpilled(const OpenNode& openNode,
+                                 std::vector<HighsDomainChange>& domchgstack,
+                                 std::vector<HighsInt>& branchings) {
+  assert(openNode.spillPos != -1);
+  domchgstack.resize(openNode.numSpilledDomchgs);
+  branchings.resize(openNode.numSpilledBranchings);
+  return std::fseek(spillFile.get(), openNode.spillPos, SEEK_SET) == 0 &&
+         std::fread(domchgstack.data(), sizeof(HighsDomainChange),
+                    openNode.numSpilledDomchgs,
+                    spillFile.get()) == size_t(openNode.numSpilledDomchgs) &&
+         std::fread(branchings.data(), sizeof(HighsInt),
+                    openNode.numSpilledBranchings,
+                    spillFile.get()) == size_t(openNode.numSpilledBranchings);
+}
+
+void HighsNodeQueue::unspill(int64_t node) {
+  OpenNode& openNode = nodes[node];
+  if (openNode.spillPos == -1) return;
+
+  bool readOk =
+      readSpilled(openNode, openNode.domchgstack, openNode.branchings);
+  assert(readOk);
+  (void)readOk;
+
+  openNode.spillPos = -1;
+  --numSpilled;
+  if (numSpilled == 0) spillFileSize = 0;
+}
+
+void HighsNodeQueue::spillNodes() {
+  // each linked domain change is stored in the node and as an element of a
+  // column-wise node set
+  constexpr double kDomchgMemory =
+      sizeof(HighsDomainChange) + sizeof(NodeSet::iterator) +
+      sizeof(NodeSet::value_type) + 4 * sizeof(void*);
+  if (numLinkedDomchgs * kDomchgMemory <= memoryLimit) return;
+
+  // spill until half of the memory limit is reached so that the spilling does
+  // not happen on every new node. Suboptimal nodes are spilled first, followed
+  // by the nodes with the worst hybrid estimate.
+  const double targetMemory = 0.5 * memoryLimit;
+  SuboptimalNodeRbTree suboptimalTree(this);
+  for (int64_t node = suboptimalTree.last(); node != -1;
+       node = suboptimalTree.predecessor(node)) {
+    if (numLinkedDomchgs * kDomchgMemory <= targetMemory) return;
+    if (nodes[node].spillPos != -1 || nodes[node].domchgstack.empty())
+      continue;
+    if (!spill(node)) return;
+  }
+
+  NodeHybridEstimRbTree estimTree(this);
+  for (int64_t node = estimTree.last(); node != -1;
+       node = estimTree.predecessor(node)) {
+    if (numLinkedDomchgs * kDomchgMemory <= targetMemory) return;
+    if (nodes[node].spillPos != -1 || nodes[node].domchgstack.empty())
+      continue;
+    if (!spill(node)) return;
+  }
+}
+
 void HighsNodeQueue::setNumCol(HighsInt numCol) {
   if (this->numCol == numCol) return;
   this->numCol = numCol;
@@ -384,12 +485,16 @@ double HighsNodeQueue::emplaceNode(std::vector<HighsDomainChange>&& domchgs,
   assert(nodes[pos].estimate == estimate);
   assert(nodes[pos].depth == depth);
 
-  return link(pos);
+  double treeweight = link(pos);
+  if (memoryLimit != kHighsInf) spillNodes();
+
+  return treeweight;
 }
 
 HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestNode() {
   int64_t bestNode = hybridEstimMin;
 
+  unspill(bestNode);
   unlink(bestNode);
 
   return std::move(nodes[bestNode]);
@@ -398,11 +503,41 @@ HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestNode() {
 HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestBoundNode() {
   int64_t bestBoundNode = lowerMin;
 
+  unspill(bestBoundNode);
   unlink(bestBoundNode);
 
   return std::move(nodes[bestBoundNode]);
 }
 
+void HighsNodeQueue::forEachOpenNode(
+    const std::function<void(const OpenNode&)>& f) {
+  auto visit = [&](int64_t node) {
+    const OpenNode& openNode = nodes[node];
+    if (openNode.spillPos == -1) {
+      f(openNode);
+      return;
+    }
+
+    std::vector<HighsDomainChange> domchgstack;
+    std::vector<HighsInt> branchings;
+    bool readOk = readSpilled(openNode, domchgstack, branchings);
+    assert(readOk);
+    (void)readOk;
+    f(OpenNode(std::move(domchgstack), std::move(branchings),
+               openNode.lower_bound, openNode.estimate, openNode.depth));
+  };
+
+  NodeLowerRbTree lowerTree(this);
+  for (int64_t node = lowerTree.first(); node != -1;
+       node = lowerTree.successor(node))
+    visit(node);
+
+  SuboptimalNodeRbTree suboptimalTree(this);
+  for (int64_t node = suboptimalTree.first(); node != -1;
+       node = suboptimalTree.successor(node))
+    visit(node);
+}
+
 double HighsNodeQueue::getBestLowerBound() const {
   double lb = lowerMin == -1 ? kHighsInf : nodes[lowerMin].lower_bound;
 
@@ -412,13 +547,11 @@ double HighsNodeQueue::getBestLowerBound() const {
 }
 
 HighsInt HighsNodeQueue::getBestBoundDomchgStackSize() const {
-  HighsInt domchgStackSize = lowerMin == -1
-                                 ? kHighsIInf
-                                 : HighsInt(nodes[lowerMin].domchgstack.size());
+  HighsInt domchgStackSize =
+      lowerMin == -1 ? kHighsIInf : nodes[lowerMin].domchgStackSize();
   if (suboptimalMin == -1) return domchgStackSize;
 
-  return std::min(HighsInt(nodes[suboptimalMin].domchgstack.size()),
-                  domchgStackSize);
+  return std::min(nodes[suboptimalMin].domchgStackSize(), domchgStackSize);
 }
 
 void HighsNodeQueue::clear() {
@@ -442,5 +575,8 @@ void HighsNodeQueue::clear() {
     (*this).numSuboptimal = nodequeue.numSuboptimal;
     (*this).optimality_limit = nodequeue.optimality_limit;
     (*this).numCol = nodequeue.numCol;
+    (*this).spillFileSize = nodequeue.spillFileSize;
+    (*this).numSpilled = nodequeue.numSpilled;
+    (*this).numLinkedDomchgs = nodequeue.numLinkedDomchgs;
   }
 }
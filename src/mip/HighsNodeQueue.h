@@ -14,6 +14,8 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstdio>
+#include <functional>
 #include <memory>
 #include <queue>
 #include <set>
@@ -148,6 +150,11 @@ class HighsNodeQueue {
     HighsInt depth;
     highs::RbTreeLinks<int64_t> lowerLinks;
     highs::RbTreeLinks<int64_t> hybridEstimLinks;
+    // position of the domain changes and branching positions in the spill
+    // file, or -1 if they are held in memory
+    int64_t spillPos;
+    HighsInt numSpilledDomchgs;
+    HighsInt numSpilledBranchings;
 
     OpenNode()
         : domchgstack(),
@@ -157,7 +164,10 @@ class HighsNodeQueue {
           estimate(-kHighsInf),
           depth(0),
           lowerLinks(),
-          hybridEstimLinks() {}
+          hybridEstimLinks(),
+          spillPos(-1),
+          numSpilledDomchgs(0),
+          numSpilledBranchings(0) {}
 
     OpenNode(std::vector<HighsDomainChange>&& domchgstack,
              std::vector<HighsInt>&& branchings, double lower_bound,
@@ -168,7 +178,14 @@ class HighsNodeQueue {
           estimate(estimate),
           depth(depth),
           lowerLinks(),
-          hybridEstimLinks() {}
+          hybridEstimLinks(),
+          spillPos(-1),
+          numSpilledDomchgs(0),
+          numSpilledBranchings(0) {}
+
+    HighsInt domchgStackSize() const {
+      return spillPos == -1 ? HighsInt(domchgstack.size()) : numSpilledDomchgs;
+    }
 
     OpenNode& operator=(OpenNode&& other) = default;
     OpenNode(OpenNode&&) = default;
@@ -199,6 +216,15 @@ class HighsNodeQueue {
   using NodeSetArray = std::unique_ptr<NodeSet, GlobalOperatorDelete>;
   NodeSetArray colLowerNodesPtr;
   NodeSetArray colUpperNodesPtr;
+
+  struct SpillFileClose {
+    void operator()(std::FILE* file) const { std::fclose(file); }
+  };
+  std::unique_ptr<std::FILE, SpillFileClose> spillFile;
+  int64_t spillFileSize = 0;
+  int64_t numSpilled = 0;
+  int64_t numLinkedDomchgs = 0;
+  double memoryLimit = kHighsInf;
   int64_t lowerRoot = -1;
   int64_t lowerMin = -1;
   int64_t hybridEstimRoot = -1;
@@ -229,11 +255,31 @@ class HighsNodeQueue {
 
   void unlink(int64_t node);
 
+  bool spill(int64_t node);
+
+  bool readSpilled(const OpenNode& openNode,
+                   std::vector<HighsDomainChange>& domchgstack,
+                   std::vector<HighsInt>& branchings);
+
+  void unspill(int64_t node);
+
+  void spillNodes();
+
  public:
   void setOptimalityLimit(double optimality_limit) {
     this->optimality_limit = optimality_limit;
   }
 
+  /// set the memory in MB that the domain changes of the open nodes may occupy
+  /// before the nodes with the worst estimates are moved to a temporary file
+  void setMemoryLimit(HighsInt memory_limit_mb) {
+    memoryLimit = memory_limit_mb == kHighsIInf
+                      ? kHighsInf
+                      : std::ldexp(double(memory_limit_mb), 20);
+  }
+
+  int64_t numSpilledNodes() const { return numSpilled; }
+
   double performBounding(double upper_limit);
 
   void setNumCol(HighsInt numcol);
@@ -282,6 +328,11 @@ class HighsNodeQueue {
 
   double pruneNode(int64_t nodeId);
 
+  /// calls the given function for every open node in the order of their
+  /// lower bounds. The domain changes of spilled nodes are read back into a
+  /// temporary node, so that the spilled nodes stay on disk.
+  void forEachOpenNode(const std::function<void(const OpenNode&)>& f);
+
   double getBestLowerBound() const;
 
   HighsInt getBestBoundDomchgStackSize() const;
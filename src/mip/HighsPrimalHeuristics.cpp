@@ -78,37 +78,20 @@ void HighsPrimalHeuristics::setupIntCols() {
   });
 }
 
-bool HighsPrimalHeuristics::solveSubMip(
-    const HighsLp& lp, const HighsBasis& basis, double fixingRate,
-    std::vector<double> colLower, std::vector<double> colUpper,
-    HighsInt maxleaves, HighsInt maxnodes, HighsInt stallnodes) {
+HighsOptions HighsPrimalHeuristics::subMipOptions(HighsInt maxleaves,
+                                                  HighsInt maxnodes,
+                                                  HighsInt stallnodes) const {
   HighsOptions submipoptions = *mipsolver.options_mip_;
-  HighsLp submip = lp;
-
-  // set bounds and restore integrality of the lp relaxation copy
-  submip.col_lower_ = std::move(colLower);
-  submip.col_upper_ = std::move(colUpper);
-  submip.integrality_ = mipsolver.model_->integrality_;
-  submip.offset_ = 0;
 
   // set limits
   submipoptions.mip_max_leaves = maxleaves;
   submipoptions.output_flag = false;
-
-  const bool allow_submip_log = true;
-  if (allow_submip_log && lp.num_col_ == -54 && lp.num_row_ == -172) {
-    submipoptions.output_flag = true;
-    printf(
-        "HighsPrimalHeuristics::solveSubMip (%d, %d) with output_flag = %s\n",
-        int(lp.num_col_), int(lp.num_row_),
-        highsBoolToString(submipoptions.output_flag).c_str());
-  }
-
   submipoptions.mip_max_nodes = maxnodes;
   submipoptions.mip_max_stall_nodes = stallnodes;
   submipoptions.mip_pscost_minreliable = 0;
   submipoptions.time_limit -=
       mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+  submipoptions.work_limit -= mipsolver.mipdata_->work_count;
   submipoptions.objective_bound = mipsolver.mipdata_->upper_limit;
 
   if (!mipsolver.submip) {
@@ -128,6 +111,34 @@ bool HighsPrimalHeuristics::solveSubMip(
   submipoptions.presolve = "on";
   submipoptions.mip_detect_symmetry = false;
   submipoptions.mip_heuristic_effort = 0.8;
+  submipoptions.mip_lns_portfolio = false;
+  submipoptions.mip_concurrent_lns = false;
+
+  return submipoptions;
+}
+
+bool HighsPrimalHeuristics::solveSubMip(
+    const HighsLp& lp, const HighsBasis& basis, double fixingRate,
+    std::vector<double> colLower, std::vector<double> colUpper,
+    HighsInt maxleaves, HighsInt maxnodes, HighsInt stallnodes) {
+  HighsOptions submipoptions = subMipOptions(maxleaves, maxnodes, stallnodes);
+  HighsLp submip = lp;
+
+  // set bounds and restore integrality of the lp relaxation copy
+  submip.col_lower_ = std::move(colLower);
+  submip.col_upper_ = std::move(colUpper);
+  submip.integrality_ = mipsolver.model_->integrality_;
+  submip.offset_ = 0;
+
+  const bool allow_submip_log = true;
+  if (allow_submip_log && lp.num_col_ == -54 && lp.num_row_ == -172) {
+    submipoptions.output_flag = true;
+    printf(
+        "HighsPrimalHeuristics::solveSubMip (%d, %d) with output_flag = %s\n",
+        int(lp.num_col_), int(lp.num_row_),
+        highsBoolToString(submipoptions.output_flag).c_str());
+  }
+
   // setup solver and run it
 
   HighsSolution solution;
@@ -143,6 +154,7 @@ bool HighsPrimalHeuristics::solveSubMip(
   submipsolver.implicinit = &mipsolver.mipdata_->implications;
   submipsolver.run();
   if (submipsolver.mipdata_) {
+    mipsolver.mipdata_->addWork(submipsolver.mipdata_->work_count);
     double numUnfixed = mipsolver.mipdata_->integral_cols.size() +
                         mipsolver.mipdata_->continuous_cols.size();
     double adjustmentfactor = submipsolver.numCol() / std::max(1.0, numUnfixed);
@@ -538,7 +550,13 @@ retry:
 }
 
 void HighsPrimalHeuristics::RINS(const std::vector<double>& relaxationsol) {
+  RINS(relaxationsol, mipsolver.mipdata_->incumbent);
+}
+
+void HighsPrimalHeuristics::RINS(const std::vector<double>& relaxationsol,
+                                 const std::vector<double>& referencesol) {
   if (int(relaxationsol.size()) != mipsolver.numCol()) return;
+  if (int(referencesol.size()) != mipsolver.numCol()) return;
 
   intcols.erase(std::remove_if(intcols.begin(), intcols.end(),
                                [&](HighsInt i) {
@@ -618,7 +636,7 @@ retry:
         heurlp.getFractionalIntegers().end(),
         [&](const std::pair<HighsInt, double>& fracvar) {
           return std::abs(relaxationsol[fracvar.first] -
-                          mipsolver.mipdata_->incumbent[fracvar.first]) <=
+                          referencesol[fracvar.first]) <=
                  mipsolver.mipdata_->feastol;
         });
 
@@ -664,7 +682,7 @@ retry:
       for (HighsInt i : intcols) {
         if (localdom.col_lower_[i] == localdom.col_upper_[i]) continue;
 
-        if (std::abs(currlpsol[i] - mipsolver.mipdata_->incumbent[i]) <=
+        if (std::abs(currlpsol[i] - referencesol[i]) <=
             mipsolver.mipdata_->feastol) {
           double fixval = HighsIntegers::nearestInteger(currlpsol[i]);
           HighsInt oldNumBranched = numBranched;
@@ -824,6 +842,431 @@ retry:
   lp_iterations += heur.getLocalLpIterations();
 }
 
+// minimum number of binary columns for local branching and proximity search
+static constexpr HighsInt kLnsMinBinaries = 10;
+// minimum fixing rate of the crossover and DINS neighbourhoods
+static constexpr double kLnsMinFixingRate = 0.3;
+// weight of the exploration term in the upper confidence bound of a
+// neighbourhood
+static constexpr double kLnsExplorationWeight = 0.5;
+
+// appends the row lower <= vals^T x <= upper to the model and the basis
+static void addLnsRow(HighsLp& model, HighsBasis& basis,
+                      const std::vector<HighsInt>& inds,
+                      const std::vector<double>& vals, double lower,
+                      double upper) {
+  HighsSparseMatrix row;
+  row.format_ = MatrixFormat::kRowwise;
+  row.num_col_ = model.num_col_;
+  row.num_row_ = 1;
+  row.start_ = {0, HighsInt(inds.size())};
+  row.index_ = inds;
+  row.value_ = vals;
+  model.a_matrix_.addRows(row);
+  model.row_lower_.push_back(lower);
+  model.row_upper_.push_back(upper);
+  if (!model.row_names_.empty()) model.row_names_.push_back("lns_row");
+  ++model.num_row_;
+  if (basis.valid) basis.row_status.push_back(HighsBasisStatus::kBasic);
+}
+
+void HighsPrimalHeuristics::setupLnsSubMip(LnsSubMip& lns) const {
+  const HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+  lns.model = *mipsolver.model_;
+  lns.model.col_lower_ = mipdata.domain.col_lower_;
+  lns.model.col_upper_ = mipdata.domain.col_upper_;
+  lns.model.offset_ = 0;
+  lns.basis = mipdata.firstrootbasis;
+  lns.options = subMipOptions(500, 200 + int(0.05 * mipdata.num_nodes), 12);
+  lns.pscostinit = std::unique_ptr<HighsPseudocostInitialization>(
+      new HighsPseudocostInitialization(mipdata.pseudocost, 1));
+}
+
+bool HighsPrimalHeuristics::localBranching(LnsSubMip& lns) const {
+  const HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+  const std::vector<double>& incumbent = mipdata.incumbent;
+
+  // restrict the binary columns to a Hamming distance of at most k from the
+  // incumbent
+  std::vector<HighsInt> inds;
+  std::vector<double> vals;
+  double rhs = 0.0;
+  for (HighsInt col : mipdata.integer_cols) {
+    if (!mipdata.domain.isBinary(col)) continue;
+    inds.push_back(col);
+    if (incumbent[col] < 0.5)
+      vals.push_back(1.0);
+    else {
+      vals.push_back(-1.0);
+      rhs -= 1.0;
+    }
+  }
+  HighsInt numBinaries = inds.size();
+  if (numBinaries < kLnsMinBinaries) return false;
+
+  setupLnsSubMip(lns);
+  HighsInt k = std::max(HighsInt{2}, std::min(HighsInt{20}, numBinaries / 10));
+  addLnsRow(lns.model, lns.basis, inds, vals, -kHighsInf, rhs + k);
+  return true;
+}
+
+bool HighsPrimalHeuristics::crossover(LnsSubMip& lns) const {
+  const HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+  if (mipsolver.submip) return false;
+
+  // the other solutions are the best ones of the solution pool or, without
+  // one, the solutions that preceded the incumbent, which are stored in the
+  // space of the original model
+  std::vector<const std::vector<double>*> others;
+  if (mipdata.solutionPool.size() >= 2) {
+    for (const HighsObjectiveSolution& sol : mipdata.solutionPool)
+      if (sol.col_value != mipsolver.solution_)
+        others.push_back(&sol.col_value);
+  } else {
+    for (auto sol = mipdata.improvingSolutions.rbegin();
+         sol != mipdata.improvingSolutions.rend(); ++sol)
+      if (sol->col_value != mipsolver.solution_)
+        others.push_back(&sol->col_value);
+  }
+
+  // the incumbent and the two best other solutions
+  std::vector<std::vector<double>> solutions;
+  solutions.push_back(mipdata.incumbent);
+  for (size_t i = 0; i < others.size() && solutions.size() < 3; ++i) {
+    solutions.push_back(
+        mipsolver.mipdata_->postSolveStack.getReducedPrimalSolution(
+            *others[i]));
+    if ((HighsInt)solutions.back().size() != mipsolver.numCol())
+      solutions.pop_back();
+  }
+  if (solutions.size() < 2) return false;
+
+  // fix the integer columns on which all solutions agree
+  setupLnsSubMip(lns);
+  HighsInt numFixed = 0;
+  HighsInt numUnfixed = 0;
+  for (HighsInt col : mipdata.integer_cols) {
+    if (mipdata.domain.isFixed(col)) continue;
+    ++numUnfixed;
+    double val = std::floor(solutions[0][col] + 0.5);
+    bool agree = true;
+    for (size_t i = 1; i < solutions.size() && agree; ++i)
+      agree = std::abs(solutions[i][col] - val) <= mipdata.feastol;
+    if (!agree || val < lns.model.col_lower_[col] ||
+        val > lns.model.col_upper_[col])
+      continue;
+    lns.model.col_lower_[col] = val;
+    lns.model.col_upper_[col] = val;
+    ++numFixed;
+  }
+
+  return numFixed >= kLnsMinFixingRate * numUnfixed && numFixed < numUnfixed;
+}
+
+bool HighsPrimalHeuristics::DINS(const std::vector<double>& relaxationsol,
+                                 LnsSubMip& lns) const {
+  const HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+  const std::vector<double>& incumbent = mipdata.incumbent;
+  if ((HighsInt)relaxationsol.size() != mipsolver.numCol() ||
+      (HighsInt)mipdata.rootlpsol.size() != mipsolver.numCol())
+    return false;
+
+  // binary columns are fixed if the incumbent value is close to the root and
+  // the current relaxation, the other integer columns are restricted to the
+  // distance between incumbent and relaxation
+  setupLnsSubMip(lns);
+  HighsInt numFixed = 0;
+  HighsInt numUnfixed = 0;
+  for (HighsInt col : mipdata.integer_cols) {
+    if (mipdata.domain.isFixed(col)) continue;
+    ++numUnfixed;
+    double delta = std::abs(incumbent[col] - relaxationsol[col]);
+    if (mipdata.domain.isBinary(col)) {
+      if (delta >= 0.5 ||
+          std::abs(incumbent[col] - mipdata.rootlpsol[col]) >= 0.5)
+        continue;
+      double val = std::floor(incumbent[col] + 0.5);
+      lns.model.col_lower_[col] = val;
+      lns.model.col_upper_[col] = val;
+    } else {
+      lns.model.col_lower_[col] =
+          std::max(lns.model.col_lower_[col],
+                   std::ceil(relaxationsol[col] - delta - mipdata.feastol));
+      lns.model.col_upper_[col] =
+          std::min(lns.model.col_upper_[col],
+                   std::floor(relaxationsol[col] + delta + mipdata.feastol));
+      if (lns.model.col_lower_[col] != lns.model.col_upper_[col]) continue;
+    }
+    ++numFixed;
+  }
+
+  return numFixed >= kLnsMinFixingRate * numUnfixed && numFixed < numUnfixed;
+}
+
+bool HighsPrimalHeuristics::proximitySearch(LnsSubMip& lns) const {
+  const HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+  const std::vector<double>& incumbent = mipdata.incumbent;
+  if (mipdata.upper_limit == kHighsInf) return false;
+
+  HighsInt numBinaries = 0;
+  for (HighsInt col : mipdata.integer_cols)
+    if (mipdata.domain.isBinary(col)) ++numBinaries;
+  if (numBinaries < kLnsMinBinaries) return false;
+
+  // minimize the Hamming distance to the incumbent over the solutions that
+  // improve on it
+  setupLnsSubMip(lns);
+  std::vector<HighsInt> inds;
+  std::vector<double> vals;
+  for (HighsInt col = 0; col != mipsolver.numCol(); ++col) {
+    double cost = mipsolver.colCost(col);
+    if (cost != 0.0) {
+      inds.push_back(col);
+      vals.push_back(cost);
+    }
+    lns.model.col_cost_[col] = 0.0;
+  }
+  if (inds.empty()) return false;
+  addLnsRow(lns.model, lns.basis, inds, vals, -kHighsInf, mipdata.upper_limit);
+
+  for (HighsInt col : mipdata.integer_cols)
+    if (mipdata.domain.isBinary(col))
+      lns.model.col_cost_[col] = incumbent[col] < 0.5 ? 1.0 : -1.0;
+
+  // the objective bound and gap of the search do not apply to the distance
+  lns.options.objective_bound = kHighsInf;
+  lns.options.mip_rel_gap = 0.0;
+  lns.options.mip_abs_gap = 0.0;
+  return true;
+}
+
+void HighsPrimalHeuristics::solveLnsSubMip(
+    LnsSubMip& lns, const HighsCliqueTable* clqtableinit,
+    const HighsImplications* implicinit) {
+  HighsSolution solution;
+  solution.value_valid = false;
+  solution.dual_valid = false;
+  HighsMipSolver submipsolver(lns.callback, lns.options, lns.model, solution,
+                              true);
+  if (lns.basis.valid) submipsolver.rootbasis = &lns.basis;
+  submipsolver.pscostinit = lns.pscostinit.get();
+  submipsolver.clqtableinit = clqtableinit;
+  submipsolver.implicinit = implicinit;
+  submipsolver.run();
+
+  lns.solved = true;
+  lns.status = submipsolver.modelstatus_;
+  lns.solution = std::move(submipsolver.solution_);
+  if (submipsolver.mipdata_) {
+    lns.numReducedCol = submipsolver.numCol();
+    lns.lp_iterations = submipsolver.mipdata_->total_lp_iterations;
+    lns.work_count = submipsolver.mipdata_->work_count;
+  }
+}
+
+double HighsPrimalHeuristics::lnsReward(double oldUpperBound) const {
+  const HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+  if (mipdata.upper_bound >= oldUpperBound) return 0.0;
+  if (oldUpperBound == kHighsInf) return 1.0;
+
+  double gap = std::max(oldUpperBound - mipdata.lower_bound, mipdata.feastol);
+  return std::min(1.0, (oldUpperBound - mipdata.upper_bound) / gap);
+}
+
+double HighsPrimalHeuristics::tryLnsSubMipSolution(LnsSubMip& lns,
+                                                   char source) {
+  if (!lns.solved) return 0.0;
+
+  // count the LP iterations relative to the size of the sub-MIP, as for the
+  // sub-MIPs of the other heuristics
+  double numUnfixed = mipsolver.mipdata_->integral_cols.size() +
+                      mipsolver.mipdata_->continuous_cols.size();
+  double effort =
+      lns.numReducedCol / std::max(1.0, numUnfixed) * lns.lp_iterations;
+  lp_iterations += int64_t(effort);
+  mipsolver.mipdata_->addWork(lns.work_count);
+
+  if (lns.status != HighsModelStatus::kInfeasible && !lns.solution.empty())
+    mipsolver.mipdata_->trySolution(lns.solution, source);
+
+  return effort;
+}
+
+void HighsPrimalHeuristics::finishLnsSubMip(LnsSubMip& lns) {
+  double oldUpperBound = mipsolver.mipdata_->upper_bound;
+  double effort = tryLnsSubMipSolution(lns, 'L');
+
+  LnsArm& arm = lnsArms[lns.neighbourhood];
+  ++arm.numCalls;
+  arm.reward += lnsReward(oldUpperBound);
+  arm.effort += effort;
+}
+
+HighsInt HighsPrimalHeuristics::selectNeighbourhood(
+    const std::array<bool, kNumLnsNeighbourhoods>& available) const {
+  // every available neighbourhood is searched once before the upper
+  // confidence bounds of their payoffs are compared
+  HighsInt numCalls = 0;
+  double effort = 0.0;
+  for (HighsInt i = 0; i != kNumLnsNeighbourhoods; ++i) {
+    if (!available[i]) continue;
+    if (lnsArms[i].numCalls == 0) return i;
+    numCalls += lnsArms[i].numCalls;
+    effort += lnsArms[i].effort;
+  }
+
+  // the payoff of a neighbourhood is its average reward per search of
+  // average effort
+  double meanEffort = std::max(1.0, effort / numCalls);
+  HighsInt best = kLnsRins;
+  double bestScore = -kHighsInf;
+  for (HighsInt i = 0; i != kNumLnsNeighbourhoods; ++i) {
+    if (!available[i]) continue;
+    const LnsArm& arm = lnsArms[i];
+    double payoff = arm.reward * meanEffort / std::max(1.0, arm.effort);
+    double score = payoff + kLnsExplorationWeight *
+                                std::sqrt(std::log(double(numCalls)) /
+                                          arm.numCalls);
+    if (score > bestScore) {
+      best = i;
+      bestScore = score;
+    }
+  }
+
+  return best;
+}
+
+void HighsPrimalHeuristics::largeNeighbourhoodSearch(
+    const std::vector<double>& relaxationsol) {
+  // the result of the previous concurrent search is taken over first so
+  // that the bandit always selects with the same information
+  finishConcurrentLns();
+  if ((HighsInt)mipsolver.mipdata_->incumbent.size() != mipsolver.numCol())
+    return;
+
+  std::array<bool, kNumLnsNeighbourhoods> available;
+  available.fill(true);
+  available[kLnsCrossover] =
+      !mipsolver.submip &&
+      std::max(mipsolver.mipdata_->solutionPool.size(),
+               mipsolver.mipdata_->improvingSolutions.size()) >= 2;
+  available[kLnsProximity] = mipsolver.mipdata_->upper_limit != kHighsInf;
+  HighsInt neighbourhood = selectNeighbourhood(available);
+
+  if (neighbourhood != kLnsRins) {
+    std::unique_ptr<LnsSubMip> lns(new LnsSubMip());
+    lns->neighbourhood = LnsNeighbourhood(neighbourhood);
+    bool nonempty = false;
+    switch (neighbourhood) {
+      case kLnsLocalBranching:
+        nonempty = localBranching(*lns);
+        break;
+      case kLnsCrossover:
+        nonempty = crossover(*lns);
+        break;
+      case kLnsDins:
+        nonempty = DINS(relaxationsol, *lns);
+        break;
+      case kLnsProximity:
+        nonempty = proximitySearch(*lns);
+    }
+
+    if (nonempty) {
+      // The concurrent sub-MIP only uses its own data and is finished at the
+      // next search or at the end of the tree search, which keeps the search
+      // deterministic. It does not take over the clique table and
+      // implications, which the tree search modifies in the meantime.
+      if (mipsolver.options_mip_->mip_concurrent_lns && !mipsolver.submip &&
+          highs::parallel::num_threads() > 1) {
+        concurrentLns = std::move(lns);
+        concurrentLnsTaskGroup = std::unique_ptr<highs::parallel::TaskGroup>(
+            new highs::parallel::TaskGroup());
+        LnsSubMip* concurrent = concurrentLns.get();
+        concurrentLnsTaskGroup->spawn([concurrent]() {
+          solveLnsSubMip(*concurrent, nullptr, nullptr);
+        });
+        return;
+      }
+
+      solveLnsSubMip(*lns, &mipsolver.mipdata_->cliquetable,
+                     &mipsolver.mipdata_->implications);
+      finishLnsSubMip(*lns);
+      return;
+    }
+
+    // the neighbourhood is not restrictive enough, so it is counted as a
+    // search without payoff and RINS is used instead
+    ++lnsArms[neighbourhood].numCalls;
+  }
+
+  double oldUpperBound = mipsolver.mipdata_->upper_bound;
+  size_t oldLpIterations = lp_iterations;
+  RINS(relaxationsol);
+  LnsArm& arm = lnsArms[kLnsRins];
+  ++arm.numCalls;
+  arm.reward += lnsReward(oldUpperBound);
+  arm.effort += lp_iterations - oldLpIterations;
+}
+
+void HighsPrimalHeuristics::finishConcurrentLns() {
+  if (!concurrentLns) return;
+
+  concurrentLnsTaskGroup->sync();
+  concurrentLnsTaskGroup.reset();
+  finishLnsSubMip(*concurrentLns);
+  concurrentLns.reset();
+}
+
+void HighsPrimalHeuristics::completeMipStarts(
+    const std::vector<HighsMipStart>& mipstarts) {
+  HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+  presolve::HighsPostsolveStack& postSolveStack = mipdata.postSolveStack;
+  const HighsInt origNumCol = mipsolver.orig_model_->num_col_;
+  if (mipsolver.numCol() == 0) return;
+
+  // the integer columns of the presolved model whose values are the values
+  // of columns of the original model
+  std::vector<HighsInt> reducedCol(origNumCol, -1);
+  std::vector<uint8_t> transformedOrigCols =
+      postSolveStack.getTransformedOrigCols();
+  for (HighsInt col : mipdata.integer_cols) {
+    HighsInt origCol = postSolveStack.getOrigColIndex(col);
+    if (!transformedOrigCols[origCol]) reducedCol[origCol] = col;
+  }
+
+  // the values of a start that are outside of the global domain are not
+  // fixed, so that the sub-MIP can repair them
+  std::vector<std::unique_ptr<LnsSubMip>> submips;
+  for (const HighsMipStart& start : mipstarts) {
+    std::unique_ptr<LnsSubMip> lns(new LnsSubMip());
+    setupLnsSubMip(*lns);
+    HighsInt numFixed = 0;
+    for (size_t i = 0; i < start.index.size(); ++i) {
+      if (start.index[i] < 0 || start.index[i] >= origNumCol) continue;
+      HighsInt col = reducedCol[start.index[i]];
+      if (col == -1) continue;
+      double val = std::floor(start.value[i] + 0.5);
+      if (val < lns->model.col_lower_[col] || val > lns->model.col_upper_[col])
+        continue;
+      lns->model.col_lower_[col] = val;
+      lns->model.col_upper_[col] = val;
+      ++numFixed;
+    }
+    if (numFixed != 0) submips.push_back(std::move(lns));
+  }
+
+  // The sub-MIPs only use their own data, so that they can be solved in
+  // parallel. Their solutions are tried in the order of the starts, which
+  // keeps the search deterministic.
+  highs::parallel::for_each(
+      0, (HighsInt)submips.size(), [&](HighsInt start, HighsInt end) {
+        for (HighsInt i = start; i < end; ++i)
+          solveLnsSubMip(*submips[i], nullptr, nullptr);
+      });
+  for (std::unique_ptr<LnsSubMip>& lns : submips)
+    tryLnsSubMipSolution(*lns, 'M');
+}
+
 bool HighsPrimalHeuristics::tryRoundedPoint(const std::vector<double>& point,
                                             char source) {
   auto localdom = mipsolver.mipdata_->domain;
@@ -11,12 +11,20 @@
 #ifndef HIGHS_PRIMAL_HEURISTICS_H_
 #define HIGHS_PRIMAL_HEURISTICS_H_
 
+#include <array>
+#include <memory>
 #include <vector>
 
 #include "lp_data/HStruct.h"
+#include "lp_data/HighsCallback.h"
 #include "lp_data/HighsLp.h"
+#include "lp_data/HighsOptions.h"
+#include "mip/HighsPseudocost.h"
+#include "parallel/HighsParallel.h"
 #include "util/HighsRandom.h"
 
+class HighsCliqueTable;
+class HighsImplications;
 class HighsMipSolver;
 
 class HighsPrimalHeuristics {
@@ -33,6 +41,74 @@ class HighsPrimalHeuristics {
 
   std::vector<HighsInt> intcols;
 
+  /// neighbourhoods of the incumbent that the large neighbourhood search
+  /// selects from
+  enum LnsNeighbourhood {
+    kLnsRins = 0,
+    kLnsLocalBranching,
+    kLnsCrossover,
+    kLnsDins,
+    kLnsProximity,
+    kNumLnsNeighbourhoods
+  };
+
+  /// payoff of the searches of a neighbourhood, the reward of a search is the
+  /// part of the gap that it closed and the effort are its LP iterations
+  struct LnsArm {
+    HighsInt numCalls = 0;
+    double reward = 0.0;
+    double effort = 0.0;
+  };
+
+  /// sub-MIP over a neighbourhood, which owns all of its data so that it can
+  /// be solved on another thread than the search
+  struct LnsSubMip {
+    LnsNeighbourhood neighbourhood;
+    HighsLp model;
+    HighsBasis basis;
+    HighsOptions options;
+    HighsCallback callback;
+    std::unique_ptr<HighsPseudocostInitialization> pscostinit;
+    bool solved = false;
+    HighsModelStatus status = HighsModelStatus::kNotset;
+    std::vector<double> solution;
+    HighsInt numReducedCol = 0;
+    int64_t lp_iterations = 0;
+    int64_t work_count = 0;
+  };
+
+  std::array<LnsArm, kNumLnsNeighbourhoods> lnsArms;
+  // declared before the task group so that the task group, which waits for
+  // the sub-MIP on destruction, is destroyed first
+  std::unique_ptr<LnsSubMip> concurrentLns;
+  std::unique_ptr<highs::parallel::TaskGroup> concurrentLnsTaskGroup;
+
+  HighsOptions subMipOptions(HighsInt maxleaves, HighsInt maxnodes,
+                             HighsInt stallnodes) const;
+
+  void setupLnsSubMip(LnsSubMip& lns) const;
+
+  bool localBranching(LnsSubMip& lns) const;
+
+  bool crossover(LnsSubMip& lns) const;
+
+  bool DINS(const std::vector<double>& relaxationsol, LnsSubMip& lns) const;
+
+  bool proximitySearch(LnsSubMip& lns) const;
+
+  static void solveLnsSubMip(LnsSubMip& lns,
+                             const HighsCliqueTable* clqtableinit,
+                             const HighsImplications* implicinit);
+
+  double tryLnsSubMipSolution(LnsSubMip& lns, char source);
+
+  void finishLnsSubMip(LnsSubMip& lns);
+
+  HighsInt selectNeighbourhood(
+      const std::array<bool, kNumLnsNeighbourhoods>& available) const;
+
+  double lnsReward(double oldUpperBound) const;
+
  public:
   HighsPrimalHeuristics(HighsMipSolver& mipsolver);
 
@@ -51,6 +127,11 @@ class HighsPrimalHeuristics {
 
   void RINS(const std::vector<double>& relaxationsol);
 
+  /// RINS with the neighbourhood defined by the given reference solution
+  /// instead of the incumbent, which need not be feasible
+  void RINS(const std::vector<double>& relaxationsol,
+            const std::vector<double>& referencesol);
+
   void feasibilityPump();
 
   void centralRounding();
@@ -63,6 +144,19 @@ class HighsPrimalHeuristics {
                           const std::vector<double>& point2, char source);
 
   void randomizedRounding(const std::vector<double>& relaxationsol);
+
+  /// searches a neighbourhood of the incumbent that is selected by a
+  /// multi-armed bandit from the payoff per effort of the earlier searches,
+  /// the sub-MIP is solved on a spare thread if mip_concurrent_lns is set
+  void largeNeighbourhoodSearch(const std::vector<double>& relaxationsol);
+
+  /// waits for the sub-MIP that is solved concurrently to the search and
+  /// tries its solution
+  void finishConcurrentLns();
+
+  /// completes the partial solutions of the original model by sub-MIPs over
+  /// the columns they do not fix, which are solved in parallel
+  void completeMipStarts(const std::vector<HighsMipStart>& mipstarts);
 };
 
 #endif
@@ -52,6 +52,7 @@ struct HighsPseudocostInitialization {
 };
 class HighsPseudocost {
   friend struct HighsPseudocostInitialization;
+  friend class HighsMipCheckpoint;
   std::vector<double> pseudocostup;
   std::vector<double> pseudocostdown;
   std::vector<HighsInt> nsamplesup;
@@ -125,6 +126,8 @@ class HighsPseudocost {
 
   HighsInt getMinReliable() const { return minreliable; }
 
+  HighsInt getNumCol() const { return pseudocostup.size(); }
+
   HighsInt getNumObservations(HighsInt col) const {
     return nsamplesup[col] + nsamplesdown[col];
   }
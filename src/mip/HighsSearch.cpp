@@ -10,9 +10,11 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 #include "mip/HighsSearch.h"
 
+#include <limits>
 #include <numeric>
 
 #include "lp_data/HConst.h"
+#include "lp_data/HighsModelUtils.h"
 #include "mip/HighsCutGeneration.h"
 #include "mip/HighsDomainChange.h"
 #include "mip/HighsMipSolverData.h"
@@ -32,6 +34,7 @@ HighsSearch::HighsSearch(HighsMipSolver& mipsolver, HighsPseudocost& pseudocost)
   inheuristic = false;
   inbranching = false;
   countTreeWeight = true;
+  subtreeRestartStackSize = std::numeric_limits<size_t>::max();
   childselrule = mipsolver.submip ? ChildSelectionRule::kHybridInferenceCost
                                   : ChildSelectionRule::kRootSol;
   this->localdom.setDomainChangeStack(std::vector<HighsDomainChange>());
@@ -391,6 +394,163 @@ HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
     return best;
   };
 
+  // when multiple threads are available the child LPs of the unreliable
+  // candidates with the best pseudocost scores are solved up front on copies
+  // of the LP relaxation that start from the basis of this node. The children
+  // are propagated here beforehand and the results are merged in candidate
+  // order, so that the outcome does not depend on the scheduling of the
+  // workers. Children that turn out to be infeasible or exceed the cutoff are
+  // left to the sequential evaluation below, which analyzes the conflict and
+  // directly branches into the other direction.
+  if (mipsolver.options_mip_->mip_parallel_strong_branching &&
+      !mipsolver.submip && highs::parallel::num_threads() > 1 &&
+      getStrongBranchingLpIterations() < maxSbIters &&
+      !mipsolver.mipdata_->checkLimits()) {
+    struct ChildLp {
+      HighsInt candidate;
+      bool up;
+      bool propagated;
+      int64_t inferences;
+      std::vector<HighsInt> cols;
+      std::vector<double> lower;
+      std::vector<double> upper;
+      HighsLpRelaxation::Status status;
+      int64_t numiters;
+      std::vector<double> sol;
+
+      ChildLp(HighsInt candidate, bool up)
+          : candidate(candidate),
+            up(up),
+            propagated(false),
+            inferences(0),
+            status(HighsLpRelaxation::Status::kNotSet),
+            numiters(0) {}
+    };
+
+    std::vector<std::pair<double, HighsInt>> unreliable;
+    for (HighsInt k = 0; k != numfrac; ++k) {
+      if (upscorereliable[k] && downscorereliable[k]) continue;
+      unreliable.emplace_back(
+          -pseudocost.getScore(fracints[k].first, fracints[k].second), k);
+    }
+    std::sort(unreliable.begin(), unreliable.end());
+
+    HighsInt maxChildren = 2 * highs::parallel::num_threads();
+    std::vector<ChildLp> children;
+    for (const auto& entry : unreliable) {
+      HighsInt k = entry.second;
+      if (!downscorereliable[k]) children.emplace_back(k, false);
+      if (!upscorereliable[k]) children.emplace_back(k, true);
+      if ((HighsInt)children.size() >= maxChildren) break;
+    }
+
+    const auto& domchgstack = localdom.getDomainChangeStack();
+    HighsInt numChangedCols = localdom.getChangedCols().size();
+    for (ChildLp& child : children) {
+      HighsInt col = fracints[child.candidate].first;
+      double fracval = fracints[child.candidate].second;
+      HighsInt domchgStackSize = domchgstack.size();
+
+      HighsDomainChange domchg =
+          child.up
+              ? HighsDomainChange{std::ceil(fracval), col,
+                                  HighsBoundType::kLower}
+              : HighsDomainChange{std::floor(fracval), col,
+                                  HighsBoundType::kUpper};
+      bool orbitalFixing =
+          nodestack.back().stabilizerOrbits && orbitsValidInChildNode(domchg);
+      localdom.changeBound(domchg);
+      localdom.propagate();
+
+      if (!localdom.infeasible()) {
+        if (orbitalFixing)
+          nodestack.back().stabilizerOrbits->orbitalFixing(localdom);
+        else
+          mipsolver.mipdata_->symmetries.propagateOrbitopes(localdom);
+      }
+
+      if (!localdom.infeasible()) {
+        child.propagated = true;
+        child.inferences = (int64_t)domchgstack.size() - domchgStackSize - 1;
+        for (HighsInt j = domchgStackSize; j < (HighsInt)domchgstack.size();
+             ++j)
+          child.cols.push_back(domchgstack[j].column);
+        std::sort(child.cols.begin(), child.cols.end());
+        child.cols.erase(std::unique(child.cols.begin(), child.cols.end()),
+                         child.cols.end());
+        for (HighsInt c : child.cols) {
+          child.lower.push_back(localdom.col_lower_[c]);
+          child.upper.push_back(localdom.col_upper_[c]);
+        }
+      }
+
+      localdom.backtrack();
+      localdom.clearChangedCols(numChangedCols);
+    }
+
+    lp->setObjectiveLimit(mipsolver.mipdata_->upper_limit);
+    highs::parallel::for_each(
+        0, (HighsInt)children.size(), [&](HighsInt start, HighsInt end) {
+          for (HighsInt i = start; i < end; ++i) {
+            ChildLp& child = children[i];
+            if (!child.propagated) continue;
+
+            HighsLpRelaxation childlp(*lp);
+            childlp.getLpSolver().changeColsBounds(
+                child.cols.size(), child.cols.data(), child.lower.data(),
+                child.upper.data());
+            child.status = childlp.run(false);
+            child.numiters = childlp.getNumLpIterations();
+            if (HighsLpRelaxation::scaledOptimal(child.status))
+              child.sol = childlp.getLpSolver().getSolution().col_value;
+          }
+        });
+
+    for (ChildLp& child : children) {
+      lpiterations += child.numiters;
+      sblpiterations += child.numiters;
+      if (!HighsLpRelaxation::scaledOptimal(child.status)) continue;
+
+      HighsInt k = child.candidate;
+      HighsInt col = fracints[k].first;
+      double fracval = fracints[k].second;
+
+      bool integerfeasible;
+      double solobj = checkSol(child.sol, integerfeasible);
+      if (HighsLpRelaxation::unscaledDualFeasible(child.status)
+              ? solobj > mipsolver.mipdata_->optimality_limit
+              : solobj > getCutoffBound())
+        continue;
+
+      double objdelta = std::max(solobj - lp->getObjective(), 0.0);
+      if (objdelta <= mipsolver.mipdata_->epsilon) objdelta = 0.0;
+
+      pseudocost.addInferenceObservation(col, child.inferences, child.up);
+      if (child.up) {
+        upscore[k] = objdelta;
+        upscorereliable[k] = true;
+        markBranchingVarUpReliableAtNode(col);
+        pseudocost.addObservation(col, std::ceil(fracval) - fracval,
+                                  objdelta);
+        if (HighsLpRelaxation::unscaledDualFeasible(child.status))
+          upbound[k] = solobj;
+      } else {
+        downscore[k] = objdelta;
+        downscorereliable[k] = true;
+        markBranchingVarDownReliableAtNode(col);
+        pseudocost.addObservation(col, std::floor(fracval) - fracval,
+                                  objdelta);
+        if (HighsLpRelaxation::unscaledDualFeasible(child.status))
+          downbound[k] = solobj;
+      }
+
+      if (HighsLpRelaxation::unscaledPrimalFeasible(child.status) &&
+          integerfeasible)
+        mipsolver.mipdata_->addIncumbent(child.sol, solobj,
+                                         inheuristic ? 'H' : 'B');
+    }
+  }
+
   HighsLpRelaxation::Playground playground = lp->playground();
 
   while (true) {
@@ -1163,6 +1323,10 @@ HighsSearch::NodeResult HighsSearch::evaluateNode() {
     }
   }
 
+  if (result == NodeResult::kOpen && subtreeRestartDue() &&
+      solveSubtreeAsSubMip())
+    result = NodeResult::kBoundExceeding;
+
   if (result != NodeResult::kOpen) {
     mipsolver.mipdata_->debugSolution.nodePruned(localdom);
     treeweight += std::ldexp(1.0, 1 - getCurrentDepth());
@@ -1177,6 +1341,91 @@ HighsSearch::NodeResult HighsSearch::evaluateNode() {
   return result;
 }
 
+bool HighsSearch::subtreeRestartDue() {
+  const HighsOptions& options = *mipsolver.options_mip_;
+  if (inheuristic || mipsolver.submip ||
+      options.mip_subtree_restart_fixing_rate >= 1.0 || getCurrentDepth() <= 1)
+    return false;
+
+  // the restart of a node that is still on the stack did not solve its
+  // subtree, which is then searched without restarts
+  if (nodestack.size() > subtreeRestartStackSize) return false;
+  subtreeRestartStackSize = std::numeric_limits<size_t>::max();
+
+  const std::vector<HighsInt>& integralCols =
+      mipsolver.mipdata_->integral_cols;
+  if (integralCols.empty()) return false;
+  HighsInt numFixed = 0;
+  for (HighsInt col : integralCols)
+    if (localdom.isFixed(col)) ++numFixed;
+
+  return numFixed >
+         options.mip_subtree_restart_fixing_rate * integralCols.size();
+}
+
+bool HighsSearch::solveSubtreeAsSubMip() {
+  HighsMipSolverData& mipdata = *mipsolver.mipdata_;
+  HighsOptions submipoptions = *mipsolver.options_mip_;
+  setSubtreeOptions(submipoptions, submipoptions.mip_subtree_node_limit);
+  // unlike the subtrees of the parallel tree search, whose open nodes are
+  // put back into the node queue, the sub-MIP is presolved in the local
+  // domain, which removes the fixed columns and the rows they make redundant
+  submipoptions.presolve = kHighsOnString;
+  submipoptions.mip_abs_gap = 0.0;
+  submipoptions.time_limit -=
+      mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+  submipoptions.work_limit -= mipdata.work_count;
+  submipoptions.objective_bound = mipdata.upper_limit;
+
+  // the sub-MIP is the current LP relaxation, including its cuts, with the
+  // bounds of the local domain
+  HighsLp submip = lp->getLp();
+  submip.integrality_ = mipsolver.model_->integrality_;
+  submip.col_lower_ = localdom.col_lower_;
+  submip.col_upper_ = localdom.col_upper_;
+  submip.offset_ = 0;
+
+  HighsSolution solution;
+  solution.value_valid = false;
+  solution.dual_valid = false;
+  HighsMipSolver submipsolver(*mipsolver.callback_, submipoptions, submip,
+                              solution, true);
+  const HighsBasis& basis = lp->getLpSolver().getBasis();
+  if (basis.valid) submipsolver.rootbasis = &basis;
+  HighsPseudocostInitialization pscostinit(
+      pseudocost, mipsolver.options_mip_->mip_pscost_minreliable);
+  submipsolver.pscostinit = &pscostinit;
+  submipsolver.clqtableinit = &mipdata.cliquetable;
+  submipsolver.implicinit = &mipdata.implications;
+  submipsolver.run();
+
+  if (submipsolver.mipdata_) {
+    nnodes += submipsolver.node_count_;
+    lpiterations += submipsolver.total_lp_iterations_;
+    mipdata.addWork(submipsolver.work_count_);
+  }
+  if (!submipsolver.solution_.empty())
+    mipdata.trySolution(submipsolver.solution_, 'W');
+
+  highsLogDev(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+              "Subtree restart at depth %" HIGHSINT_FORMAT
+              ": sub-MIP %s after %" PRId64 " nodes\n",
+              getCurrentDepth(),
+              utilModelStatusToString(submipsolver.modelstatus_).c_str(),
+              submipsolver.node_count_);
+
+  if (submipsolver.modelstatus_ == HighsModelStatus::kOptimal ||
+      submipsolver.modelstatus_ == HighsModelStatus::kInfeasible)
+    return true;
+
+  NodeData& currnode = nodestack.back();
+  currnode.lower_bound =
+      std::max(currnode.lower_bound,
+               std::min(submipsolver.dual_bound_, mipdata.upper_limit));
+  subtreeRestartStackSize = nodestack.size();
+  return false;
+}
+
 HighsSearch::NodeResult HighsSearch::branch() {
   assert(localdom.getChangedCols().empty());
 
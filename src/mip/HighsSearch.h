@@ -47,6 +47,9 @@ class HighsSearch {
   bool inbranching;
   bool inheuristic;
   bool countTreeWeight;
+  // size of the node stack at the last subtree restart that did not solve
+  // its subtree, the nodes below it are not restarted again
+  size_t subtreeRestartStackSize;
 
  public:
   enum class ChildSelectionRule {
@@ -139,6 +142,16 @@ class HighsSearch {
 
   bool orbitsValidInChildNode(const HighsDomainChange& branchChg) const;
 
+  /// returns whether the fixed integer columns in the local domain of the
+  /// current node exceed the fixing rate for subtree restarts
+  bool subtreeRestartDue();
+
+  /// presolves and solves the subtree of the current node as a sub-MIP and
+  /// returns whether the subtree was solved, in which case it can be pruned.
+  /// Otherwise the lower bound of the node is updated with the dual bound of
+  /// the sub-MIP.
+  bool solveSubtreeAsSubMip();
+
  public:
   HighsSearch(HighsMipSolver& mipsolver, HighsPseudocost& pseudocost);
 
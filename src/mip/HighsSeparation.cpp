@@ -109,13 +109,61 @@ HighsInt HighsSeparation::separationRound(HighsDomain& propdomain,
     status = HighsLpRelaxation::Status::kInfeasible;
     return 0;
   }
-  HighsLpAggregator lpAggregator(*lp);
+  const HighsOptions& options = *lp->getMipSolver().options_mip_;
+  if (options.mip_parallel_separation && highs::parallel::num_threads() > 1) {
+    // the separators only read the LP relaxation, so they can run as
+    // concurrent tasks when each of them has its own aggregator, transformed
+    // LP and cut pool. The cuts are afterwards added to the global cut pool in
+    // the order of the separators, which discards duplicates.
+    HighsInt numSeparators = separators.size();
+    std::vector<HighsTransformedLp> sepaTransLps(numSeparators, transLp);
+    std::vector<std::unique_ptr<HighsCutPool>> sepaPools;
+    sepaPools.reserve(numSeparators);
+    for (HighsInt i = 0; i != numSeparators; ++i)
+      sepaPools.emplace_back(new HighsCutPool(lp->numCols(),
+                                              options.mip_pool_age_limit,
+                                              options.mip_pool_soft_limit));
+
+    highs::parallel::for_each(
+        0, numSeparators,
+        [&](HighsInt start, HighsInt end) {
+          for (HighsInt i = start; i < end; ++i) {
+            HighsLpAggregator lpAggregator(*lp);
+            separators[i]->run(*lp, lpAggregator, sepaTransLps[i],
+                               *sepaPools[i]);
+          }
+        },
+        1);
+
+    std::vector<HighsInt> cutinds;
+    std::vector<double> cutvals;
+    for (const std::unique_ptr<HighsCutPool>& sepaPool : sepaPools) {
+      for (HighsInt cut = 0; cut != sepaPool->getMatrix().getNumRows();
+           ++cut) {
+        HighsInt cutlen;
+        const HighsInt* inds;
+        const double* vals;
+        sepaPool->getCut(cut, cutlen, inds, vals);
+        cutinds.assign(inds, inds + cutlen);
+        cutvals.assign(vals, vals + cutlen);
+        mipdata.cutpool.addCut(lp->getMipSolver(), cutinds.data(),
+                               cutvals.data(), cutlen, sepaPool->getRhs()[cut],
+                               sepaPool->cutIsIntegral(cut));
+        if (mipdata.domain.infeasible()) {
+          status = HighsLpRelaxation::Status::kInfeasible;
+          return 0;
+        }
+      }
+    }
+  } else {
+    HighsLpAggregator lpAggregator(*lp);
 
-  for (const std::unique_ptr<HighsSeparator>& separator : separators) {
-    separator->run(*lp, lpAggregator, transLp, mipdata.cutpool);
-    if (mipdata.domain.infeasible()) {
-      status = HighsLpRelaxation::Status::kInfeasible;
-      return 0;
+    for (const std::unique_ptr<HighsSeparator>& separator : separators) {
+      separator->run(*lp, lpAggregator, transLp, mipdata.cutpool);
+      if (mipdata.domain.infeasible()) {
+        status = HighsLpRelaxation::Status::kInfeasible;
+        return 0;
+      }
     }
   }
 
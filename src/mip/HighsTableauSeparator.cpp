@@ -47,7 +47,10 @@ void HighsTableauSeparator::separateLpSolution(HighsLpRelaxation& lpRelaxation,
   if (!lpSolver.hasInvert()) return;
 
   const HighsMipSolver& mip = lpRelaxation.getMipSolver();
-  if (cutpool.getNumAvailableCuts() > mip.options_mip_->mip_pool_soft_limit)
+  // the soft limit refers to the global cut pool also when the cuts are
+  // collected in a separate pool
+  if (mip.mipdata_->cutpool.getNumAvailableCuts() >
+      mip.options_mip_->mip_pool_soft_limit)
     return;
 
   const HighsInt* basisinds =
@@ -0,0 +1,119 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+#include "mip/HighsTreeSizeEstimator.h"
+
+#include <algorithm>
+#include <array>
+
+#include "lp_data/HConst.h"
+
+// weight of the most recent observation in the smoothed rates
+static constexpr double kSmoothingFactor = 0.3;
+
+void HighsTreeSizeEstimator::reset(int64_t numNodes, int64_t numLeaves,
+                                   double time) {
+  nodesStart = numNodes;
+  leavesStart = numLeaves;
+  timeStart = time;
+
+  lastNodes = numNodes;
+  lastTreeWeight = 0.0;
+  lastGap = kHighsInf;
+  treeWeightRate = 0.0;
+  gapRate = 0.0;
+
+  treeWeight = 0.0;
+  remainingNodesBacktrack = kHighsInf;
+  remainingNodesTreeWeight = kHighsInf;
+  remainingNodesGap = kHighsInf;
+  remainingNodes = kHighsInf;
+  remainingTime = kHighsInf;
+}
+
+void HighsTreeSizeEstimator::complete() {
+  treeWeight = 1.0;
+  remainingNodesBacktrack = 0.0;
+  remainingNodesTreeWeight = 0.0;
+  remainingNodesGap = 0.0;
+  remainingNodes = 0.0;
+  remainingTime = 0.0;
+}
+
+void HighsTreeSizeEstimator::update(int64_t numNodes, int64_t numLeaves,
+                                    double treeWeight, double gap,
+                                    double time) {
+  this->treeWeight = std::min(std::max(treeWeight, 0.0), 1.0);
+  // the gap as a fraction that is at most one, so that the gap closed per
+  // node does not depend on the scale of the objective
+  gap = gap == kHighsInf ? kHighsInf : std::min(gap / 100.0, 1.0);
+
+  if (this->treeWeight == 1.0 || gap == 0.0) {
+    complete();
+    lastNodes = numNodes;
+    lastTreeWeight = this->treeWeight;
+    lastGap = gap;
+    return;
+  }
+
+  int64_t runNodes = numNodes - nodesStart;
+  int64_t runLeaves = numLeaves - leavesStart;
+
+  if (numNodes > lastNodes) {
+    double deltaNodes = double(numNodes - lastNodes);
+    double weightRate =
+        std::max(this->treeWeight - lastTreeWeight, 0.0) / deltaNodes;
+    treeWeightRate = treeWeightRate == 0.0
+                         ? weightRate
+                         : kSmoothingFactor * weightRate +
+                               (1.0 - kSmoothingFactor) * treeWeightRate;
+
+    if (gap != kHighsInf && lastGap != kHighsInf) {
+      double closedRate = std::max(lastGap - gap, 0.0) / deltaNodes;
+      gapRate = gapRate == 0.0 ? closedRate
+                               : kSmoothingFactor * closedRate +
+                                     (1.0 - kSmoothingFactor) * gapRate;
+    }
+
+    lastNodes = numNodes;
+    lastTreeWeight = this->treeWeight;
+  }
+  // a new incumbent starts the measurement of the gap closed per node
+  if (gap == kHighsInf || lastGap == kHighsInf) gapRate = 0.0;
+  lastGap = gap;
+
+  remainingNodesBacktrack = kHighsInf;
+  if (runLeaves > 0 && this->treeWeight > 0.0)
+    remainingNodesBacktrack = std::max(
+        2.0 * runLeaves / this->treeWeight - 1.0 - runNodes, 0.0);
+
+  remainingNodesTreeWeight = kHighsInf;
+  if (treeWeightRate > 0.0)
+    remainingNodesTreeWeight = (1.0 - this->treeWeight) / treeWeightRate;
+
+  remainingNodesGap = kHighsInf;
+  if (gap != kHighsInf && gapRate > 0.0) remainingNodesGap = gap / gapRate;
+
+  std::array<double, 3> estimates;
+  size_t numEstimates = 0;
+  for (double estimate : {remainingNodesBacktrack, remainingNodesTreeWeight,
+                          remainingNodesGap})
+    if (estimate != kHighsInf) estimates[numEstimates++] = estimate;
+
+  remainingNodes = kHighsInf;
+  if (numEstimates != 0) {
+    std::sort(estimates.begin(), estimates.begin() + numEstimates);
+    remainingNodes = estimates[numEstimates / 2];
+  }
+
+  remainingTime = kHighsInf;
+  if (runNodes > 0 && remainingNodes != kHighsInf)
+    remainingTime = remainingNodes * (time - timeStart) / runNodes;
+}
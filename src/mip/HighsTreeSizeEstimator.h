@@ -0,0 +1,87 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2023 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsTreeSizeEstimator.h
+ * @brief Online estimates of the remaining size of the branch-and-bound tree
+ */
+
+#ifndef HIGHS_TREE_SIZE_ESTIMATOR_H_
+#define HIGHS_TREE_SIZE_ESTIMATOR_H_
+
+#include <cstdint>
+
+/// Estimates the number of nodes that remain to be explored in the current run
+/// of the branch-and-bound search, and the time this takes, with three
+/// methods:
+///
+/// - weighted backtrack estimation: a leaf at depth d is reached with
+///   probability 2^-d by a random descent in a binary tree, so the number of
+///   leaves of the tree is estimated by the number of leaves found divided by
+///   their total weight, which is the tree weight. A binary tree with L leaves
+///   has 2L - 1 nodes.
+/// - tree weight extrapolation: the remaining tree weight divided by the
+///   exponentially smoothed increase of the tree weight per node.
+/// - gap closed rate: the remaining relative gap divided by the exponentially
+///   smoothed decrease of the gap per node.
+///
+/// The estimates are for reporting only and do not affect the search.
+class HighsTreeSizeEstimator {
+ public:
+  HighsTreeSizeEstimator() { reset(0, 0, 0.0); }
+
+  /// starts the estimation for a new run of the search
+  void reset(int64_t numNodes, int64_t numLeaves, double time);
+
+  /// updates the estimates with the current state of the search. The gap is
+  /// the relative gap between the primal and dual bound in percent, and
+  /// infinite while there is no incumbent.
+  void update(int64_t numNodes, int64_t numLeaves, double treeWeight,
+              double gap, double time);
+
+  /// sets the estimates for a search that is complete
+  void complete();
+
+  double getTreeWeight() const { return treeWeight; }
+
+  double getRemainingNodesBacktrack() const { return remainingNodesBacktrack; }
+
+  double getRemainingNodesTreeWeight() const {
+    return remainingNodesTreeWeight;
+  }
+
+  double getRemainingNodesGap() const { return remainingNodesGap; }
+
+  /// upper median of the finite estimates of the three methods, or infinity
+  /// if there is none
+  double getRemainingNodes() const { return remainingNodes; }
+
+  /// remaining nodes times the average time per node of the current run
+  double getRemainingTime() const { return remainingTime; }
+
+ private:
+  int64_t nodesStart;
+  int64_t leavesStart;
+  double timeStart;
+
+  int64_t lastNodes;
+  double lastTreeWeight;
+  double lastGap;
+  double treeWeightRate;
+  double gapRate;
+
+  double treeWeight;
+  double remainingNodesBacktrack;
+  double remainingNodesTreeWeight;
+  double remainingNodesGap;
+  double remainingNodes;
+  double remainingTime;
+};
+
+#endif
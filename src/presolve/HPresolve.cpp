@@ -27,6 +27,7 @@
 #include "mip/HighsObjectiveFunction.h"
 #include "pdqsort/pdqsort.h"
 #include "presolve/HighsPostsolveStack.h"
+#include "presolve/HighsSymmetry.h"
 #include "test/DevKkt.h"
 #include "util/HFactor.h"
 #include "util/HighsCDouble.h"
@@ -4369,7 +4370,18 @@ HighsModelStatus HPresolve::run(HighsPostsolveStack& postsolve_stack) {
     }
     presolve_status_ = HighsPresolveStatus::kReducedToEmpty;
     return HighsModelStatus::kOptimal;
-  } else if (postsolve_stack.numReductions() > 0) {
+  }
+
+  if (!mipsolver && options->use_implied_bounds_from_presolve)
+    setRelaxedImpliedBounds();
+
+  // Aggregating the orbits of a symmetric LP yields no basis in
+  // postsolve
+  if (!mipsolver && !options->lp_presolve_requires_basis_postsolve &&
+      analysis_.allow_rule_[kPresolveRuleOrbitalAggregation])
+    orbitalAggregation(postsolve_stack);
+
+  if (postsolve_stack.numReductions() > 0) {
     // Reductions performed
     presolve_status_ = HighsPresolveStatus::kReduced;
   } else {
@@ -4377,9 +4389,6 @@ HighsModelStatus HPresolve::run(HighsPostsolveStack& postsolve_stack) {
     presolve_status_ = HighsPresolveStatus::kNotReduced;
   }
 
-  if (!mipsolver && options->use_implied_bounds_from_presolve)
-    setRelaxedImpliedBounds();
-
   assert(presolve_status_ != HighsPresolveStatus::kNotSet);
   return HighsModelStatus::kNotset;
 }
@@ -6198,6 +6207,141 @@ void HPresolve::setRelaxedImpliedBounds() {
 }
 
 // Not currently called
+void HPresolve::orbitalAggregation(HighsPostsolveStack& postsolve_stack) {
+  // If the LP is symmetric, averaging an optimal solution over the symmetry
+  // group yields an optimal solution that is constant on each orbit of
+  // columns. Hence the columns of each orbit can be aggregated into one
+  // column, and the rows of an orbit become identical and only one of them
+  // needs to be kept. Here the model is already compressed and in column
+  // major format.
+  HighsSymmetryDetection symDetection;
+  symDetection.loadModelAsGraph(*model, options->small_matrix_value);
+  if (!symDetection.initializeDetection()) return;
+
+  std::vector<HighsInt> orbitRepresentative;
+  symDetection.computeOrbits(orbitRepresentative);
+
+  const HighsInt numCol = model->num_col_;
+  const HighsInt numRow = model->num_row_;
+  std::vector<HighsInt> orbitSize(numCol + numRow);
+  for (HighsInt i = 0; i != numCol + numRow; ++i)
+    ++orbitSize[orbitRepresentative[i]];
+
+  std::vector<HighsPostsolveStack::OrbitMember> colMembers;
+  std::vector<HighsPostsolveStack::OrbitMember> rowMembers;
+  std::vector<HighsInt> newColIndex(numCol, -1);
+  std::vector<HighsInt> newRowIndex(numRow, -1);
+  HighsInt newNumCol = 0;
+  for (HighsInt i = 0; i != numCol; ++i) {
+    HighsInt rep = orbitRepresentative[i];
+    if (orbitSize[rep] > 1) colMembers.emplace_back(i, rep, orbitSize[rep]);
+    if (rep == i) newColIndex[i] = newNumCol++;
+  }
+  HighsInt newNumRow = 0;
+  for (HighsInt i = 0; i != numRow; ++i) {
+    HighsInt rep = orbitRepresentative[numCol + i];
+    if (orbitSize[rep] > 1)
+      rowMembers.emplace_back(i, rep - numCol, orbitSize[rep]);
+    if (rep == numCol + i) newRowIndex[i] = newNumRow++;
+  }
+
+  if (colMembers.empty() && rowMembers.empty()) return;
+
+  // the aggregated column of an orbit has the summed up costs and, in each
+  // remaining row, the sum of the coefficients of the orbit's columns
+  std::vector<HighsInt> orbitColStart(numCol + 1);
+  for (HighsInt i = 0; i != numCol; ++i)
+    ++orbitColStart[newColIndex[orbitRepresentative[i]] + 1];
+  for (HighsInt i = 0; i != newNumCol; ++i)
+    orbitColStart[i + 1] += orbitColStart[i];
+  std::vector<HighsInt> orbitCols(numCol);
+  {
+    std::vector<HighsInt> orbitColPos(orbitColStart.begin(),
+                                      orbitColStart.begin() + newNumCol);
+    for (HighsInt i = 0; i != numCol; ++i)
+      orbitCols[orbitColPos[newColIndex[orbitRepresentative[i]]]++] = i;
+  }
+
+  HighsSparseMatrix& matrix = model->a_matrix_;
+  std::vector<double> newValue;
+  std::vector<HighsInt> newIndex;
+  std::vector<HighsInt> newStart(newNumCol + 1);
+  std::vector<double> newCost(newNumCol);
+  std::vector<HighsCDouble> rowSum(newNumRow);
+  std::vector<HighsInt> rowSumCol(newNumRow, -1);
+  std::vector<HighsInt> rowSumIndex;
+  newValue.reserve(matrix.value_.size());
+  newIndex.reserve(matrix.index_.size());
+  for (HighsInt k = 0; k != newNumCol; ++k) {
+    HighsCDouble cost = 0.0;
+    for (HighsInt p = orbitColStart[k]; p != orbitColStart[k + 1]; ++p) {
+      HighsInt col = orbitCols[p];
+      cost += model->col_cost_[col];
+      for (HighsInt j = matrix.start_[col]; j != matrix.start_[col + 1];
+           ++j) {
+        HighsInt row = newRowIndex[matrix.index_[j]];
+        if (row == -1) continue;
+        if (rowSumCol[row] != k) {
+          rowSumCol[row] = k;
+          rowSumIndex.push_back(row);
+        }
+        rowSum[row] += matrix.value_[j];
+      }
+    }
+
+    newCost[k] = double(cost);
+    pdqsort(rowSumIndex.begin(), rowSumIndex.end());
+    for (HighsInt row : rowSumIndex) {
+      double value = double(rowSum[row]);
+      rowSum[row] = 0.0;
+      if (std::abs(value) <= options->small_matrix_value) continue;
+      newIndex.push_back(row);
+      newValue.push_back(value);
+    }
+    rowSumIndex.clear();
+    newStart[k + 1] = newIndex.size();
+  }
+
+  // bounds and names of the representatives are kept
+  for (HighsInt i = 0; i != numCol; ++i) {
+    if (newColIndex[i] == -1) continue;
+    model->col_lower_[newColIndex[i]] = model->col_lower_[i];
+    model->col_upper_[newColIndex[i]] = model->col_upper_[i];
+    if (!model->col_names_.empty())
+      model->col_names_[newColIndex[i]] = std::move(model->col_names_[i]);
+  }
+  for (HighsInt i = 0; i != numRow; ++i) {
+    if (newRowIndex[i] == -1) continue;
+    model->row_lower_[newRowIndex[i]] = model->row_lower_[i];
+    model->row_upper_[newRowIndex[i]] = model->row_upper_[i];
+    if (!model->row_names_.empty())
+      model->row_names_[newRowIndex[i]] = std::move(model->row_names_[i]);
+  }
+
+  model->num_col_ = newNumCol;
+  model->num_row_ = newNumRow;
+  model->col_cost_ = std::move(newCost);
+  model->col_lower_.resize(newNumCol);
+  model->col_upper_.resize(newNumCol);
+  model->integrality_.resize(newNumCol);
+  if (!model->col_names_.empty()) model->col_names_.resize(newNumCol);
+  model->row_lower_.resize(newNumRow);
+  model->row_upper_.resize(newNumRow);
+  if (!model->row_names_.empty()) model->row_names_.resize(newNumRow);
+  matrix.value_ = std::move(newValue);
+  matrix.index_ = std::move(newIndex);
+  matrix.start_ = std::move(newStart);
+  model->setMatrixDimensions();
+
+  postsolve_stack.orbitalAggregation(colMembers, rowMembers);
+  postsolve_stack.compressIndexMaps(newRowIndex, newColIndex);
+
+  highsLogUser(options->log_options, HighsLogType::kInfo,
+               "Orbital aggregation reduced LP to %" HIGHSINT_FORMAT
+               " rows and %" HIGHSINT_FORMAT " columns\n",
+               newNumRow, newNumCol);
+}
+
 void HPresolve::debug(const HighsLp& lp, const HighsOptions& options) {
   HighsSolution reducedsol;
   HighsBasis reducedbasis;
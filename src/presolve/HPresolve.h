@@ -333,6 +333,8 @@ class HPresolve {
 
   Result sparsify(HighsPostsolveStack& postsolve_stack);
 
+  void orbitalAggregation(HighsPostsolveStack& postsolve_stack);
+
   void setRelaxedImpliedBounds();
 
   const HighsPresolveLog& getPresolveLog() const {
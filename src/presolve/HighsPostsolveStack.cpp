@@ -14,6 +14,7 @@
 
 #include "lp_data/HConst.h"
 #include "lp_data/HighsOptions.h"
+#include "parallel/HighsParallel.h"
 #include "util/HighsCDouble.h"
 
 namespace presolve {
@@ -1325,4 +1326,126 @@ void HighsPostsolveStack::DuplicateColumn::transformToPresolvedSpace(
   primalSol[col] = primalSol[col] + colScale * primalSol[duplicateCol];
 }
 
+void HighsPostsolveStack::OrbitalAggregation::undo(
+    const HighsOptions& options, const std::vector<OrbitMember>& colMembers,
+    const std::vector<OrbitMember>& rowMembers, HighsSolution& solution,
+    HighsBasis& basis) const {
+  assert((HighsInt)colMembers.size() == numColMembers);
+  assert((HighsInt)rowMembers.size() == numRowMembers);
+
+  // the solution of the aggregated LP lifts to a solution where all members
+  // of an orbit take the value of the orbit representative
+  for (const OrbitMember& member : colMembers)
+    solution.col_value[member.index] =
+        solution.col_value[member.representative];
+  for (const OrbitMember& member : rowMembers)
+    solution.row_value[member.index] =
+        solution.row_value[member.representative];
+
+  if (solution.dual_valid) {
+    // the aggregated column carries the cost of all columns in its orbit and
+    // the representative row stands for all rows in its orbit, hence the dual
+    // values are divided evenly among the members of the orbits. The
+    // representatives are scaled last as their values are read before.
+    for (const OrbitMember& member : colMembers)
+      if (member.index != member.representative)
+        solution.col_dual[member.index] =
+            solution.col_dual[member.representative] / member.orbitSize;
+    for (const OrbitMember& member : colMembers)
+      if (member.index == member.representative)
+        solution.col_dual[member.index] /= member.orbitSize;
+
+    for (const OrbitMember& member : rowMembers)
+      if (member.index != member.representative)
+        solution.row_dual[member.index] =
+            solution.row_dual[member.representative] / member.orbitSize;
+    for (const OrbitMember& member : rowMembers)
+      if (member.index == member.representative)
+        solution.row_dual[member.index] /= member.orbitSize;
+  }
+
+  // a basic solution of the aggregated LP does not yield a basis of the
+  // original LP
+  basis.valid = false;
+}
+
+HighsInt HighsPostsolveStack::getBatchableReductionCol(
+    HighsInt reduction) const {
+  HighsInt position = reductions[reduction].second;
+  switch (reductions[reduction].first) {
+    case ReductionType::kLinearTransform: {
+      LinearTransform linearTransform;
+      reductionValues.pop(position, linearTransform);
+      return linearTransform.col;
+    }
+    case ReductionType::kFixedCol: {
+      FixedCol fixedCol;
+      reductionValues.skipVector<Nonzero>(position);
+      reductionValues.pop(position, fixedCol);
+      return fixedCol.col;
+    }
+    default:
+      return -1;
+  }
+}
+
+void HighsPostsolveStack::computeUndoBatches(
+    std::vector<std::pair<HighsInt, HighsInt>>& undoBatches) const {
+  undoBatches.clear();
+  if ((HighsInt)reductions.size() < kMinUndoBatchSize) return;
+
+  // for each column store the end of the batch it was last seen in, batch ends
+  // are strictly decreasing so they identify the batch uniquely
+  std::vector<HighsInt> colBatchEnd(origNumCol, -1);
+  HighsInt batchEnd = reductions.size();
+  for (HighsInt i = reductions.size() - 1; i >= -1; --i) {
+    HighsInt col = i >= 0 ? getBatchableReductionCol(i) : -1;
+    if (col == -1 || colBatchEnd[col] == batchEnd) {
+      // the reduction cannot join the current batch, close it
+      if (batchEnd - (i + 1) >= kMinUndoBatchSize)
+        undoBatches.emplace_back(i + 1, batchEnd);
+      batchEnd = col == -1 ? i : i + 1;
+    }
+    if (col != -1) colBatchEnd[col] = batchEnd;
+  }
+}
+
+void HighsPostsolveStack::undoBatch(const HighsOptions& options,
+                                    HighsInt start, HighsInt end,
+                                    HighsSolution& solution,
+                                    HighsBasis& basis) {
+  auto undoRange = [&](HighsInt rangeStart, HighsInt rangeEnd) {
+    std::vector<Nonzero> batchColValues;
+    for (HighsInt i = rangeStart; i < rangeEnd; ++i) {
+      HighsInt position = reductions[i].second;
+      switch (reductions[i].first) {
+        case ReductionType::kLinearTransform: {
+          LinearTransform reduction;
+          reductionValues.pop(position, reduction);
+          reduction.undo(options, solution);
+          break;
+        }
+        case ReductionType::kFixedCol: {
+          FixedCol reduction;
+          reductionValues.pop(position, batchColValues);
+          reductionValues.pop(position, reduction);
+          reduction.undo(options, batchColValues, solution, basis);
+          break;
+        }
+        default:
+          assert(false);
+      }
+    }
+  };
+
+  // the scheduler is not initialized when postsolve is called outside of a
+  // call to Highs::run()
+  if (HighsTaskExecutor::getThisWorkerDeque() != nullptr)
+    highs::parallel::for_each(start, end, undoRange, kUndoBatchGrainSize);
+  else
+    undoRange(start, end);
+
+  reductionValues.setPosition(start == 0 ? 0 : reductions[start - 1].second);
+}
+
 }  // namespace presolve
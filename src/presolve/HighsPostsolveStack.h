@@ -59,6 +59,19 @@ class HighsPostsolveStack {
     Nonzero(HighsInt index_, double value_) : index(index_), value(value_) {}
     Nonzero() = default;
   };
+  /// member of an orbit of columns or rows under a symmetry group of the LP
+  struct OrbitMember {
+    HighsInt index;
+    HighsInt representative;
+    HighsInt orbitSize;
+
+    OrbitMember(HighsInt index_, HighsInt representative_,
+                HighsInt orbitSize_)
+        : index(index_),
+          representative(representative_),
+          orbitSize(orbitSize_) {}
+    OrbitMember() = default;
+  };
 
   size_t debug_prev_numreductions = 0;
   double debug_prev_col_lower = 0;
@@ -216,6 +229,19 @@ class HighsPostsolveStack {
     void transformToPresolvedSpace(std::vector<double>& primalSol) const;
   };
 
+  /// the columns of each orbit of a symmetry group of the LP are aggregated
+  /// into one representative column and all but the representative row of
+  /// each row orbit are removed
+  struct OrbitalAggregation {
+    HighsInt numColMembers;
+    HighsInt numRowMembers;
+
+    void undo(const HighsOptions& options,
+              const std::vector<OrbitMember>& colMembers,
+              const std::vector<OrbitMember>& rowMembers,
+              HighsSolution& solution, HighsBasis& basis) const;
+  };
+
   /// tags for reduction
   enum class ReductionType : uint8_t {
     kLinearTransform,
@@ -231,6 +257,7 @@ class HighsPostsolveStack {
     kForcingColumnRemovedRow,
     kDuplicateRow,
     kDuplicateColumn,
+    kOrbitalAggregation,
   };
 
   HighsDataStack reductionValues;
@@ -241,6 +268,8 @@ class HighsPostsolveStack {
 
   std::vector<Nonzero> rowValues;
   std::vector<Nonzero> colValues;
+  std::vector<OrbitMember> colOrbitMembers;
+  std::vector<OrbitMember> rowOrbitMembers;
   HighsInt origNumCol = -1;
   HighsInt origNumRow = -1;
 
@@ -249,6 +278,29 @@ class HighsPostsolveStack {
     reductions.emplace_back(type, position);
   }
 
+  /// minimal number of consecutive independent reductions for which the undo
+  /// is performed as one batch in parallel
+  static constexpr HighsInt kMinUndoBatchSize = 1024;
+  static constexpr HighsInt kUndoBatchGrainSize = 256;
+
+  /// returns the original column index that a reduction of the kinds
+  /// kFixedCol and kLinearTransform acts on, and -1 for all other kinds
+  HighsInt getBatchableReductionCol(HighsInt reduction) const;
+
+  /// compute ranges [start, end) of consecutive reductions that only fix or
+  /// linearly transform pairwise distinct columns. Those reductions read the
+  /// row duals and write the values of their own column only, so they do not
+  /// depend on each other and can be undone in any order. The ranges are
+  /// returned in descending order.
+  void computeUndoBatches(
+      std::vector<std::pair<HighsInt, HighsInt>>& undoBatches) const;
+
+  /// undo the independent reductions in [start, end) in parallel. The
+  /// position of the reduction value stack is left at the data of reduction
+  /// start.
+  void undoBatch(const HighsOptions& options, HighsInt start, HighsInt end,
+                 HighsSolution& solution, HighsBasis& basis);
+
  public:
   HighsInt getOrigRowIndex(HighsInt row) const {
     assert(row < (HighsInt)origRowIndex.size());
@@ -507,6 +559,34 @@ class HighsPostsolveStack {
     return true;
   }
 
+  /// aggregate the columns and rows of each orbit of a symmetry group of the
+  /// LP into the representative of the orbit. The members of the non-trivial
+  /// orbits, including their representatives, are given by their current
+  /// indices.
+  void orbitalAggregation(const std::vector<OrbitMember>& colMembers,
+                          const std::vector<OrbitMember>& rowMembers) {
+    colOrbitMembers.clear();
+    for (const OrbitMember& member : colMembers) {
+      colOrbitMembers.emplace_back(origColIndex[member.index],
+                                   origColIndex[member.representative],
+                                   member.orbitSize);
+      // the columns of an orbit are tied to their representative
+      linearlyTransformable[origColIndex[member.index]] = false;
+    }
+
+    rowOrbitMembers.clear();
+    for (const OrbitMember& member : rowMembers)
+      rowOrbitMembers.emplace_back(origRowIndex[member.index],
+                                   origRowIndex[member.representative],
+                                   member.orbitSize);
+
+    reductionValues.push(OrbitalAggregation{(HighsInt)colMembers.size(),
+                                            (HighsInt)rowMembers.size()});
+    reductionValues.push(colOrbitMembers);
+    reductionValues.push(rowOrbitMembers);
+    reductionAdded(ReductionType::kOrbitalAggregation);
+  }
+
   std::vector<double> getReducedPrimalSolution(
       const std::vector<double>& origPrimalSolution) {
     std::vector<double> reducedSolution = origPrimalSolution;
@@ -541,6 +621,37 @@ class HighsPostsolveStack {
     return reducedSolution;
   }
 
+  /// returns a flag for each column of the original problem that is merged
+  /// with a duplicate column or linearly transformed, i.e. whose value in the
+  /// reduced problem differs from its original value
+  std::vector<uint8_t> getTransformedOrigCols() {
+    std::vector<uint8_t> transformedOrigCols(origNumCol);
+
+    for (const std::pair<ReductionType, HighsInt>& primalColTransformation :
+         reductions) {
+      switch (primalColTransformation.first) {
+        case ReductionType::kDuplicateColumn: {
+          DuplicateColumn duplicateColReduction;
+          reductionValues.setPosition(primalColTransformation.second);
+          reductionValues.pop(duplicateColReduction);
+          transformedOrigCols[duplicateColReduction.col] = 1;
+          break;
+        }
+        case ReductionType::kLinearTransform: {
+          reductionValues.setPosition(primalColTransformation.second);
+          LinearTransform linearTransform;
+          reductionValues.pop(linearTransform);
+          transformedOrigCols[linearTransform.col] = 1;
+          break;
+        }
+        default:
+          continue;
+      }
+    }
+
+    return transformedOrigCols;
+  }
+
   bool isColLinearlyTransformable(HighsInt col) const {
     return linearlyTransformable[col];
   }
@@ -593,8 +704,21 @@ class HighsPostsolveStack {
         basis.row_status[origRowIndex[i]] = basis.row_status[i];
     }
 
+    // find the batches of independent reductions that can be undone in
+    // parallel, unless single reductions are reported
+    std::vector<std::pair<HighsInt, HighsInt>> undoBatches;
+    if (report_col < 0) computeUndoBatches(undoBatches);
+    auto nextBatch = undoBatches.begin();
+
     // now undo the changes
     for (HighsInt i = reductions.size() - 1; i >= 0; --i) {
+      if (nextBatch != undoBatches.end() && nextBatch->second == i + 1) {
+        undoBatch(options, nextBatch->first, nextBatch->second, solution,
+                  basis);
+        i = nextBatch->first;
+        ++nextBatch;
+        continue;
+      }
       if (report_col >= 0)
         printf("Before  reduction %2d (type %2d): col_value[%2d] = %g\n",
                int(i), int(reductions[i].first), int(report_col),
@@ -688,6 +812,15 @@ class HighsPostsolveStack {
           reduction.undo(options, solution, basis);
           break;
         }
+        case ReductionType::kOrbitalAggregation: {
+          OrbitalAggregation reduction;
+          reductionValues.pop(rowOrbitMembers);
+          reductionValues.pop(colOrbitMembers);
+          reductionValues.pop(reduction);
+          reduction.undo(options, colOrbitMembers, rowOrbitMembers, solution,
+                         basis);
+          break;
+        }
         default:
           printf("Reduction case %d not handled\n", int(reductions[i].first));
           if (kAllowDeveloperAssert) assert(1 == 0);
@@ -870,6 +1003,15 @@ class HighsPostsolveStack {
           DuplicateColumn reduction;
           reductionValues.pop(reduction);
           reduction.undo(options, solution, basis);
+          break;
+        }
+        case ReductionType::kOrbitalAggregation: {
+          OrbitalAggregation reduction;
+          reductionValues.pop(rowOrbitMembers);
+          reductionValues.pop(colOrbitMembers);
+          reductionValues.pop(reduction);
+          reduction.undo(options, colOrbitMembers, rowOrbitMembers, solution,
+                         basis);
         }
       }
     }
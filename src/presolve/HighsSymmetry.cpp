@@ -1326,6 +1326,9 @@ HighsSymmetryDetection::dumpCurrentGraph() {
 }
 
 void HighsSymmetryDetection::switchToNextNode(HighsInt backtrackDepth) {
+  // the search of a branch of the root node ends at the root node
+  if (rootBranchSearch)
+    backtrackDepth = std::max(backtrackDepth, searchDepthLimit);
   HighsInt stackEnd = cellCreationStack.size();
   // we need to backtrack the datastructures
   nodeStack.resize(backtrackDepth);
@@ -1340,6 +1343,12 @@ void HighsSymmetryDetection::switchToNextNode(HighsInt backtrackDepth) {
         std::min(currNode.certificateEnd, firstLeavePrefixLen);
     bestLeavePrefixLen = std::min(currNode.certificateEnd, bestLeavePrefixLen);
     currNodeCertificate.resize(currNode.certificateEnd);
+    if ((HighsInt)nodeStack.size() == searchDepthLimit) {
+      // the remaining branches of this node are not explored by this search,
+      // restore the state of the node and stop
+      cleanupBacktrack(stackEnd);
+      return;
+    }
     if (!determineNextToDistinguish()) {
       nodeStack.pop_back();
       continue;
@@ -1690,15 +1699,41 @@ bool HighsSymmetryDetection::initializeDetection() {
   return true;
 }
 
-void HighsSymmetryDetection::run(HighsSymmetries& symmetries) {
-  assert(numActiveCols != 0);
-  initializeGroundSet();
-  currNodeCertificate.clear();
-  cellCreationStack.clear();
-  createNode();
-  HighsInt maxPerms = 64000000 / numActiveCols;
+HighsInt* HighsSymmetryDetection::storeAutomorphism(
+    const std::vector<HighsInt>& leavePartition) {
+  HighsInt k = (numAutomorphisms++) & 63;
+  HighsInt* permutation = automorphisms.data() + k * numVertices;
+  for (HighsInt i = 0; i < numVertices; ++i)
+    permutation[vertexPosition[currentPartition[i]]] = leavePartition[i];
+
+  return permutation;
+}
+
+bool HighsSymmetryDetection::reportAutomorphism(const HighsInt* permutation,
+                                                HighsSymmetries& symmetries,
+                                                HighsInt maxPerms) {
+  bool report = false;
+  for (HighsInt i = 0; i < numVertices; ++i) {
+    if (mergeOrbits(permutation[i], vertexGroundSet[i]) && i < numActiveCols) {
+      assert(permutation[i] < numCol);
+      report = true;
+    }
+  }
+
+  if (report) {
+    symmetries.permutations.insert(symmetries.permutations.end(), permutation,
+                                   permutation + numActiveCols);
+    ++symmetries.numPerms;
+    if (symmetries.numPerms == maxPerms) return false;
+  }
+
+  return true;
+}
+
+bool HighsSymmetryDetection::searchTree(HighsSymmetries& symmetries,
+                                        HighsInt maxPerms) {
   HighsSplitDeque* workerDeque = HighsTaskExecutor::getThisWorkerDeque();
-  while (!nodeStack.empty()) {
+  while ((HighsInt)nodeStack.size() > searchDepthLimit) {
     HighsInt targetCell = selectTargetCell();
     if (targetCell == -1) {
       if (firstLeavePartition.empty()) {
@@ -1712,9 +1747,12 @@ void HighsSymmetryDetection::run(HighsSymmetries& symmetries) {
         bestLeavePrefixLen = currNodeCertificate.size();
 
         HighsInt backtrackDepth = firstPathDepth - 1;
-        while (backtrackDepth > 0 &&
+        while (backtrackDepth > 0 && onlyBinaryOrbits &&
                !isFromBinaryColumn(nodeStack[backtrackDepth - 1].targetCell))
           --backtrackDepth;
+        // the remaining branches of the root node are explored in parallel
+        // once the search returns to it
+        if (parallelRootBranches) searchDepthLimit = 1;
         switchToNextNode(backtrackDepth);
       } else {
         HighsInt wrongCell = -1;
@@ -1722,60 +1760,16 @@ void HighsSymmetryDetection::run(HighsSymmetries& symmetries) {
         assert(currNodeCertificate.size() == firstLeaveCertificate.size());
         if (firstLeavePrefixLen == (HighsInt)currNodeCertificate.size() ||
             bestLeavePrefixLen == (HighsInt)currNodeCertificate.size()) {
+          const HighsInt* permutation = nullptr;
           if (firstLeavePrefixLen == (HighsInt)currNodeCertificate.size() &&
               compareCurrentGraph(firstLeaveGraph, wrongCell)) {
-            HighsInt k = (numAutomorphisms++) & 63;
-            HighsInt* permutation = automorphisms.data() + k * numVertices;
-            for (HighsInt i = 0; i < numVertices; ++i) {
-              HighsInt firstLeaveCol = firstLeavePartition[i];
-              permutation[vertexPosition[currentPartition[i]]] = firstLeaveCol;
-            }
-
-            bool report = false;
-            for (HighsInt i = 0; i < numVertices; ++i) {
-              if (mergeOrbits(permutation[i], vertexGroundSet[i]) &&
-                  i < numActiveCols) {
-                assert(permutation[i] < numCol);
-                report = true;
-              }
-            }
-
-            if (report) {
-              symmetries.permutations.insert(symmetries.permutations.end(),
-                                             permutation,
-                                             permutation + numActiveCols);
-              ++symmetries.numPerms;
-              if (symmetries.numPerms == maxPerms) break;
-            }
+            permutation = storeAutomorphism(firstLeavePartition);
             backtrackDepth = std::min(backtrackDepth, firstPathDepth);
           } else if (!bestLeavePartition.empty() &&
                      bestLeavePrefixLen ==
                          (HighsInt)currNodeCertificate.size() &&
                      compareCurrentGraph(bestLeaveGraph, wrongCell)) {
-            HighsInt k = (numAutomorphisms++) & 63;
-            HighsInt* permutation = automorphisms.data() + k * numVertices;
-            for (HighsInt i = 0; i < numVertices; ++i) {
-              HighsInt bestLeaveCol = bestLeavePartition[i];
-              permutation[vertexPosition[currentPartition[i]]] = bestLeaveCol;
-            }
-
-            bool report = false;
-            for (HighsInt i = 0; i < numVertices; ++i) {
-              if (mergeOrbits(permutation[i], vertexGroundSet[i]) &&
-                  i < numActiveCols) {
-                assert(permutation[i] < numCol);
-                report = true;
-              }
-            }
-
-            if (report) {
-              symmetries.permutations.insert(symmetries.permutations.end(),
-                                             permutation,
-                                             permutation + numActiveCols);
-              ++symmetries.numPerms;
-              if (symmetries.numPerms == maxPerms) break;
-            }
-
+            permutation = storeAutomorphism(bestLeavePartition);
             backtrackDepth = std::min(backtrackDepth, bestPathDepth);
           } else if (bestLeavePrefixLen <
                          (HighsInt)currNodeCertificate.size() &&
@@ -1805,6 +1799,15 @@ void HighsSymmetryDetection::run(HighsSymmetries& symmetries) {
               }
             }
           }
+
+          if (permutation != nullptr) {
+            if (rootBranchSearch)
+              branchAutomorphisms.insert(branchAutomorphisms.end(),
+                                         permutation,
+                                         permutation + numVertices);
+            else if (!reportAutomorphism(permutation, symmetries, maxPerms))
+              return false;
+          }
         } else {
           // leave must have a lexicographically smaller certificate value
           // than the current best leave, because its prefix length is smaller
@@ -1848,6 +1851,143 @@ void HighsSymmetryDetection::run(HighsSymmetries& symmetries) {
     }
   }
 
+  return true;
+}
+
+void HighsSymmetryDetection::exploreRootBranch(HighsInt vertex,
+                                               HighsSymmetries& symmetries) {
+  assert(nodeStack.size() == 1u && searchDepthLimit == 1);
+  HighsInt targetCell = nodeStack[0].targetCell;
+  HighsInt targetCellEnd = currentPartitionLinks[targetCell];
+  distinguishCands.clear();
+  for (HighsInt i = targetCell; i < targetCellEnd; ++i) {
+    if (currentPartition[i] == vertex) {
+      distinguishCands.push_back(&currentPartition[i]);
+      break;
+    }
+  }
+  assert(distinguishCands.size() == 1u);
+
+  // a failure to distinguish the vertex leaves the partition unchanged
+  if (!distinguishVertex(targetCell)) return;
+
+  if (!partitionRefinement()) {
+    // backtrack the cells created during the refinement
+    switchToNextNode(1);
+    return;
+  }
+
+  createNode();
+  // the search returns once it has backtracked to the root node again, which
+  // restores the partition of the root node
+  searchTree(symmetries, kHighsIInf);
+}
+
+void HighsSymmetryDetection::exploreRootBranches(HighsSymmetries& symmetries,
+                                                 HighsInt maxPerms) {
+  assert(nodeStack.size() == 1u);
+  const Node& rootNode = nodeStack[0];
+  std::vector<HighsInt> candidates;
+  for (HighsInt i = rootNode.targetCell;
+       i < currentPartitionLinks[rootNode.targetCell]; ++i) {
+    HighsInt vertex = currentPartition[i];
+    if (vertex > rootNode.lastDistiguished &&
+        vertexGroundSet[getOrbit(vertex)] == vertex)
+      candidates.push_back(vertex);
+  }
+  pdqsort(candidates.begin(), candidates.end());
+
+  // The candidates are explored in waves. The automorphisms found for the
+  // candidates of a wave are merged into the orbits in the order of the
+  // candidates, so that the result does not depend on the scheduling of the
+  // tasks. Candidates that end up in the orbit of a smaller candidate are
+  // skipped, just like in the sequential search.
+  const HighsInt numThreads = highs::parallel::num_threads();
+  const HighsInt waveSize = 4 * numThreads;
+  std::vector<std::unique_ptr<HighsSymmetryDetection>> workers(numThreads);
+  std::vector<HighsInt> wave;
+  std::vector<std::vector<HighsInt>> waveAutomorphisms;
+  HighsInt numCandidates = candidates.size();
+  HighsInt nextCandidate = 0;
+  while (nextCandidate < numCandidates) {
+    wave.clear();
+    while (nextCandidate < numCandidates && (HighsInt)wave.size() < waveSize) {
+      HighsInt vertex = candidates[nextCandidate++];
+      if (vertexGroundSet[getOrbit(vertex)] == vertex) wave.push_back(vertex);
+    }
+    HighsInt numWave = wave.size();
+    waveAutomorphisms.resize(numWave);
+
+    highs::parallel::for_each(0, numWave, [&](HighsInt start, HighsInt end) {
+      std::unique_ptr<HighsSymmetryDetection>& worker =
+          workers[highs::parallel::thread_num()];
+      if (!worker) {
+        worker.reset(new HighsSymmetryDetection(*this));
+        worker->rootBranchSearch = true;
+        worker->searchDepthLimit = 1;
+      }
+      for (HighsInt i = start; i < end; ++i) {
+        worker->branchAutomorphisms.clear();
+        worker->exploreRootBranch(wave[i], symmetries);
+        waveAutomorphisms[i] = worker->branchAutomorphisms;
+      }
+    });
+
+    for (HighsInt i = 0; i < numWave; ++i) {
+      if (vertexGroundSet[getOrbit(wave[i])] != wave[i]) continue;
+
+      HighsInt numBranchAutomorphisms =
+          waveAutomorphisms[i].size() / numVertices;
+      for (HighsInt k = 0; k < numBranchAutomorphisms; ++k) {
+        if (!reportAutomorphism(waveAutomorphisms[i].data() + k * numVertices,
+                                symmetries, maxPerms))
+          return;
+      }
+    }
+  }
+}
+
+void HighsSymmetryDetection::searchAutomorphisms(HighsSymmetries& symmetries) {
+  assert(numActiveCols != 0);
+  initializeGroundSet();
+  currNodeCertificate.clear();
+  cellCreationStack.clear();
+  createNode();
+  HighsInt maxPerms = 64000000 / numActiveCols;
+  parallelRootBranches = highs::parallel::num_threads() > 1;
+  searchDepthLimit = 0;
+  if (searchTree(symmetries, maxPerms) && !nodeStack.empty())
+    exploreRootBranches(symmetries, maxPerms);
+  nodeStack.clear();
+  searchDepthLimit = 0;
+}
+
+void HighsSymmetryDetection::computeOrbits(
+    std::vector<HighsInt>& orbitRepresentative) {
+  onlyBinaryOrbits = false;
+  HighsSymmetries symmetries;
+  searchAutomorphisms(symmetries);
+
+  // vertices that were removed as fix points are not part of the ground set
+  // and form their own orbit
+  HighsInt numAllVertices = numCol + numRow;
+  std::vector<HighsInt> orbitMinVertex(numVertices, -1);
+  orbitRepresentative.resize(numAllVertices);
+  for (HighsInt i = 0; i < numAllVertices; ++i) {
+    if (vertexPosition[i] == -1) {
+      orbitRepresentative[i] = i;
+      continue;
+    }
+
+    HighsInt orbit = getOrbit(i);
+    if (orbitMinVertex[orbit] == -1) orbitMinVertex[orbit] = i;
+    orbitRepresentative[i] = orbitMinVertex[orbit];
+  }
+}
+
+void HighsSymmetryDetection::run(HighsSymmetries& symmetries) {
+  searchAutomorphisms(symmetries);
+
   symmetries.numGenerators = symmetries.numPerms;
   if (symmetries.numPerms > 0) {
     vertexPosition.resize(numCol);
@@ -199,6 +199,20 @@ class HighsSymmetryDetection {
 
   std::vector<Node> nodeStack;
 
+  // the search does not backtrack above this depth. When the branches of the
+  // root node are explored in parallel, each branch is searched on a copy of
+  // this object with a depth limit of one
+  HighsInt searchDepthLimit = 0;
+  bool parallelRootBranches = false;
+  bool rootBranchSearch = false;
+  // for MIP only the orbits of binary columns are of interest and the search
+  // does not backtrack to nodes whose target cell does not stem from binary
+  // columns
+  bool onlyBinaryOrbits = true;
+  // automorphisms found while searching a single branch of the root node, they
+  // are merged into the orbits in a deterministic order after the search
+  std::vector<HighsInt> branchAutomorphisms;
+
   HighsInt getCellStart(HighsInt pos);
 
   void backtrack(HighsInt backtrackStackNewEnd, HighsInt backtrackStackEnd);
@@ -233,6 +247,14 @@ class HighsSymmetryDetection {
   bool determineNextToDistinguish();
   void createNode();
 
+  HighsInt* storeAutomorphism(const std::vector<HighsInt>& leavePartition);
+  bool reportAutomorphism(const HighsInt* permutation,
+                          HighsSymmetries& symmetries, HighsInt maxPerms);
+  bool searchTree(HighsSymmetries& symmetries, HighsInt maxPerms);
+  void exploreRootBranch(HighsInt vertex, HighsSymmetries& symmetries);
+  void exploreRootBranches(HighsSymmetries& symmetries, HighsInt maxPerms);
+  void searchAutomorphisms(HighsSymmetries& symmetries);
+
   HighsInt cellSize(HighsInt cell) const {
     return currentPartitionLinks[cell] - cell;
   }
@@ -278,6 +300,11 @@ class HighsSymmetryDetection {
   bool initializeDetection();
 
   void run(HighsSymmetries& symmetries);
+
+  /// search the automorphisms of all columns and rows and store for each
+  /// vertex the smallest vertex in its orbit. Columns are the vertices
+  /// [0, numCol) and rows the vertices [numCol, numCol + numRow).
+  void computeOrbits(std::vector<HighsInt>& orbitRepresentative);
 };
 
 #endif
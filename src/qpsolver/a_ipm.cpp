@@ -0,0 +1,720 @@
+#include "qpsolver/a_ipm.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#include "util/HFactor.h"
+
+// fraction of the step to the boundary that is taken
+static const double kStepToBoundary = 0.995;
+// initial primal and dual regularization of the augmented system, which is
+// increased if the system is found to be singular
+static const double kInitialRegularization = 1E-9;
+static const double kMaxRegularization = 1E-4;
+// number of iterative refinement steps with the unregularized system
+static const HighsInt kRefinementSteps = 2;
+// iteration count after which the method is considered to have failed
+static const HighsInt kMaxIterations = 200;
+// number of iterations without progress after which the method has stalled
+static const HighsInt kMaxStalledIterations = 30;
+// magnitude of iterates from which the QP is considered infeasible or
+// unbounded
+static const double kDivergence = 1E20;
+
+// The primal variables of the interior point method are the columns followed
+// by the row activities, so that index k refers to column k if k < num_var
+// and to row k - num_var otherwise.
+struct IpmData {
+  HighsInt num_var;
+  HighsInt num_con;
+  HighsInt num_primal;
+
+  std::vector<double> lower;
+  std::vector<double> upper;
+
+  // position of each primal variable in the augmented system, or -1 if it
+  // is fixed
+  std::vector<HighsInt> position;
+  HighsInt num_free;
+  HighsInt num_complementarity;
+
+  // primal values, row duals, and slacks and duals of the finite bounds
+  std::vector<double> v;
+  std::vector<double> y;
+  std::vector<double> s_lo;
+  std::vector<double> s_up;
+  std::vector<double> z_lo;
+  std::vector<double> z_up;
+
+  // residuals of the dual and primal equations and of the bounds
+  std::vector<double> r_dual;
+  std::vector<double> r_primal;
+  std::vector<double> r_lo;
+  std::vector<double> r_up;
+
+  // augmented system, stored column-wise with the position of the diagonal
+  // entry of each column, and the diagonal of the Hessian for each free
+  // column
+  std::vector<HighsInt> kkt_start;
+  std::vector<HighsInt> kkt_index;
+  std::vector<double> kkt_value;
+  std::vector<HighsInt> kkt_diagonal;
+  std::vector<double> hessian_diagonal;
+  std::vector<HighsInt> basic_index;
+  HFactor factor;
+  double regularization;
+
+  // buffers
+  std::vector<double> qx;
+  std::vector<double> aty;
+  std::vector<double> rhs;
+  std::vector<double> sol;
+  std::vector<double> work;
+};
+
+struct IpmStep {
+  std::vector<double> dv;
+  std::vector<double> dy;
+  std::vector<double> ds_lo;
+  std::vector<double> ds_up;
+  std::vector<double> dz_lo;
+  std::vector<double> dz_up;
+
+  IpmStep(HighsInt num_primal, HighsInt num_con)
+      : dv(num_primal),
+        dy(num_con),
+        ds_lo(num_primal),
+        ds_up(num_primal),
+        dz_lo(num_primal),
+        dz_up(num_primal) {}
+};
+
+static bool haslower(const IpmData& data, HighsInt k) {
+  return data.position[k] >= 0 &&
+         data.lower[k] > -std::numeric_limits<double>::infinity();
+}
+
+static bool hasupper(const IpmData& data, HighsInt k) {
+  return data.position[k] >= 0 &&
+         data.upper[k] < std::numeric_limits<double>::infinity();
+}
+
+// target[row] = A * x for the column values x
+static void computeactivity(const Instance& instance, const double* x,
+                            std::vector<double>& target) {
+  const MatrixBase& A = instance.A.mat;
+  target.assign(instance.num_con, 0.0);
+  for (HighsInt col = 0; col < instance.num_var; col++) {
+    if (x[col] == 0.0) continue;
+    for (HighsInt idx = A.start[col]; idx < A.start[col + 1]; idx++)
+      target[A.index[idx]] += A.value[idx] * x[col];
+  }
+}
+
+// target[col] = Q * x for the column values x
+static void computehessianproduct(const Instance& instance, const double* x,
+                                  std::vector<double>& target) {
+  const MatrixBase& Q = instance.Q.mat;
+  target.assign(instance.num_var, 0.0);
+  for (HighsInt col = 0; col < instance.num_var; col++) {
+    if (x[col] == 0.0) continue;
+    for (HighsInt idx = Q.start[col]; idx < Q.start[col + 1]; idx++)
+      target[Q.index[idx]] += Q.value[idx] * x[col];
+  }
+}
+
+// target[col] = A^T * y
+static void computetransposeproduct(const Instance& instance,
+                                    const std::vector<double>& y,
+                                    std::vector<double>& target) {
+  const MatrixBase& A = instance.A.mat;
+  target.assign(instance.num_var, 0.0);
+  for (HighsInt col = 0; col < instance.num_var; col++) {
+    double dot = 0.0;
+    for (HighsInt idx = A.start[col]; idx < A.start[col + 1]; idx++)
+      dot += A.value[idx] * y[A.index[idx]];
+    target[col] = dot;
+  }
+}
+
+static void setup(Instance& instance, IpmData& data) {
+  const HighsInt n = instance.num_var;
+  const HighsInt m = instance.num_con;
+  data.num_var = n;
+  data.num_con = m;
+  data.num_primal = n + m;
+
+  data.lower = instance.var_lo;
+  data.lower.insert(data.lower.end(), instance.con_lo.begin(),
+                    instance.con_lo.end());
+  data.upper = instance.var_up;
+  data.upper.insert(data.upper.end(), instance.con_up.begin(),
+                    instance.con_up.end());
+
+  data.position.assign(data.num_primal, -1);
+  data.num_free = 0;
+  data.num_complementarity = 0;
+  for (HighsInt k = 0; k < data.num_primal; k++) {
+    if (data.lower[k] == data.upper[k]) continue;
+    data.position[k] = data.num_free++;
+    if (haslower(data, k)) data.num_complementarity++;
+    if (hasupper(data, k)) data.num_complementarity++;
+  }
+
+  // pattern of the augmented system: the free primal variables followed by
+  // one dual variable for each row
+  const MatrixBase& A = instance.A.mat;
+  const MatrixBase& Q = instance.Q.mat;
+  const MatrixBase& Atran = instance.A.t();
+  const HighsInt dim = data.num_free + m;
+  data.kkt_start.assign(1, 0);
+  data.kkt_index.clear();
+  data.kkt_value.clear();
+  data.kkt_diagonal.assign(dim, -1);
+  data.hessian_diagonal.assign(n, 0.0);
+  for (HighsInt k = 0; k < data.num_primal; k++) {
+    const HighsInt pos = data.position[k];
+    if (pos < 0) continue;
+    data.kkt_diagonal[pos] = data.kkt_index.size();
+    data.kkt_index.push_back(pos);
+    data.kkt_value.push_back(0.0);
+    if (k < n) {
+      for (HighsInt idx = Q.start[k]; idx < Q.start[k + 1]; idx++) {
+        const HighsInt row = Q.index[idx];
+        if (row == k) {
+          data.hessian_diagonal[k] += Q.value[idx];
+        } else if (data.position[row] >= 0) {
+          data.kkt_index.push_back(data.position[row]);
+          data.kkt_value.push_back(-Q.value[idx]);
+        }
+      }
+      for (HighsInt idx = A.start[k]; idx < A.start[k + 1]; idx++) {
+        data.kkt_index.push_back(data.num_free + A.index[idx]);
+        data.kkt_value.push_back(A.value[idx]);
+      }
+    } else {
+      data.kkt_index.push_back(data.num_free + k - n);
+      data.kkt_value.push_back(-1.0);
+    }
+    data.kkt_start.push_back(data.kkt_index.size());
+  }
+  for (HighsInt row = 0; row < m; row++) {
+    data.kkt_diagonal[data.num_free + row] = data.kkt_index.size();
+    data.kkt_index.push_back(data.num_free + row);
+    data.kkt_value.push_back(0.0);
+    for (HighsInt idx = Atran.start[row]; idx < Atran.start[row + 1]; idx++) {
+      const HighsInt pos = data.position[Atran.index[idx]];
+      if (pos < 0) continue;
+      data.kkt_index.push_back(pos);
+      data.kkt_value.push_back(Atran.value[idx]);
+    }
+    if (data.position[n + row] >= 0) {
+      data.kkt_index.push_back(data.position[n + row]);
+      data.kkt_value.push_back(-1.0);
+    }
+    data.kkt_start.push_back(data.kkt_index.size());
+  }
+  data.regularization = kInitialRegularization;
+
+  data.rhs.resize(dim);
+  data.sol.resize(dim);
+  data.work.resize(dim);
+}
+
+// Starting point that satisfies the bounds with slacks of at least one where
+// possible, and duals of one
+static void initialpoint(Instance& instance, IpmData& data) {
+  const HighsInt n = data.num_var;
+  data.v.assign(data.num_primal, 0.0);
+  for (HighsInt k = 0; k < n; k++)
+    if (data.position[k] < 0) data.v[k] = data.lower[k];
+  std::vector<double> activity;
+  computeactivity(instance, data.v.data(), activity);
+  for (HighsInt row = 0; row < data.num_con; row++)
+    data.v[n + row] = activity[row];
+
+  data.s_lo.assign(data.num_primal, 0.0);
+  data.s_up.assign(data.num_primal, 0.0);
+  data.z_lo.assign(data.num_primal, 0.0);
+  data.z_up.assign(data.num_primal, 0.0);
+  for (HighsInt k = 0; k < data.num_primal; k++) {
+    if (data.position[k] < 0) {
+      data.v[k] = data.lower[k];
+      continue;
+    }
+    const bool lo = haslower(data, k);
+    const bool up = hasupper(data, k);
+    double& value = data.v[k];
+    if (lo && up) {
+      if (data.upper[k] - data.lower[k] < 2.0)
+        value = 0.5 * (data.lower[k] + data.upper[k]);
+      else
+        value = std::min(std::max(value, data.lower[k] + 1.0),
+                         data.upper[k] - 1.0);
+    } else if (lo) {
+      value = std::max(value, data.lower[k] + 1.0);
+    } else if (up) {
+      value = std::min(value, data.upper[k] - 1.0);
+    }
+    if (lo) {
+      data.s_lo[k] = value - data.lower[k];
+      data.z_lo[k] = 1.0;
+    }
+    if (up) {
+      data.s_up[k] = data.upper[k] - value;
+      data.z_up[k] = 1.0;
+    }
+  }
+  data.y.assign(data.num_con, 0.0);
+}
+
+static void computeresiduals(Instance& instance, IpmData& data) {
+  const HighsInt n = data.num_var;
+  computehessianproduct(instance, data.v.data(), data.qx);
+  computetransposeproduct(instance, data.y, data.aty);
+
+  data.r_dual.assign(data.num_primal, 0.0);
+  data.r_lo.assign(data.num_primal, 0.0);
+  data.r_up.assign(data.num_primal, 0.0);
+  for (HighsInt k = 0; k < data.num_primal; k++) {
+    if (data.position[k] < 0) continue;
+    double r = k < n ? instance.c.value[k] + data.qx[k] - data.aty[k]
+                     : data.y[k - n];
+    if (haslower(data, k)) {
+      r -= data.z_lo[k];
+      data.r_lo[k] = data.lower[k] + data.s_lo[k] - data.v[k];
+    }
+    if (hasupper(data, k)) {
+      r += data.z_up[k];
+      data.r_up[k] = data.upper[k] - data.v[k] - data.s_up[k];
+    }
+    data.r_dual[k] = r;
+  }
+
+  computeactivity(instance, data.v.data(), data.r_primal);
+  for (HighsInt row = 0; row < data.num_con; row++)
+    data.r_primal[row] = data.v[n + row] - data.r_primal[row];
+}
+
+// sets up and factors the augmented system for the current iterate,
+// increasing the regularization until the system is nonsingular
+static bool factorize(IpmData& data) {
+  const HighsInt n = data.num_var;
+  const HighsInt dim = data.num_free + data.num_con;
+  while (true) {
+    for (HighsInt k = 0; k < data.num_primal; k++) {
+      const HighsInt pos = data.position[k];
+      if (pos < 0) continue;
+      double diagonal = data.regularization;
+      if (k < n) diagonal += data.hessian_diagonal[k];
+      if (haslower(data, k)) diagonal += data.z_lo[k] / data.s_lo[k];
+      if (hasupper(data, k)) diagonal += data.z_up[k] / data.s_up[k];
+      data.kkt_value[data.kkt_diagonal[pos]] = -diagonal;
+    }
+    for (HighsInt row = 0; row < data.num_con; row++)
+      data.kkt_value[data.kkt_diagonal[data.num_free + row]] =
+          data.regularization;
+
+    // a new factor object, since the pivot sequence of the previous
+    // factorization may be unstable for the new values
+    data.basic_index.resize(dim);
+    for (HighsInt i = 0; i < dim; i++) data.basic_index[i] = i;
+    data.factor = HFactor();
+    data.factor.setup(dim, dim, data.kkt_start.data(), data.kkt_index.data(),
+                      data.kkt_value.data(), data.basic_index.data());
+    if (data.factor.build() == 0) return true;
+
+    data.regularization *= 100.0;
+    if (data.regularization > kMaxRegularization) return false;
+  }
+}
+
+// solves the augmented system for data.rhs, improving the solution of the
+// regularized system by iterative refinement
+static void solveaugmented(IpmData& data) {
+  const HighsInt dim = data.num_free + data.num_con;
+  // the factorization may have permuted the basic index, so that entry i of
+  // the result of FTRAN is the value of variable basic_index[i]
+  data.work = data.rhs;
+  data.factor.ftranCall(data.work);
+  for (HighsInt i = 0; i < dim; i++)
+    data.sol[data.basic_index[i]] = data.work[i];
+  for (HighsInt step = 0; step < kRefinementSteps; step++) {
+    // residual of the unregularized system
+    data.work = data.rhs;
+    for (HighsInt col = 0; col < dim; col++) {
+      const double x = data.sol[col];
+      if (x == 0.0) continue;
+      for (HighsInt idx = data.kkt_start[col]; idx < data.kkt_start[col + 1];
+           idx++)
+        data.work[data.kkt_index[idx]] -= data.kkt_value[idx] * x;
+      data.work[col] += col < data.num_free ? -data.regularization * x
+                                            : data.regularization * x;
+    }
+    data.factor.ftranCall(data.work);
+    for (HighsInt i = 0; i < dim; i++)
+      data.sol[data.basic_index[i]] += data.work[i];
+  }
+}
+
+// computes the Newton step for the given right hand sides of the
+// complementarity conditions
+static void computestep(IpmData& data, const std::vector<double>& r_clo,
+                        const std::vector<double>& r_cup, IpmStep& step) {
+  for (HighsInt k = 0; k < data.num_primal; k++) {
+    const HighsInt pos = data.position[k];
+    if (pos < 0) continue;
+    double rhs = -data.r_dual[k];
+    if (haslower(data, k))
+      rhs += (r_clo[k] + data.z_lo[k] * data.r_lo[k]) / data.s_lo[k];
+    if (hasupper(data, k))
+      rhs -= (r_cup[k] - data.z_up[k] * data.r_up[k]) / data.s_up[k];
+    data.rhs[pos] = -rhs;
+  }
+  for (HighsInt row = 0; row < data.num_con; row++)
+    data.rhs[data.num_free + row] = data.r_primal[row];
+
+  solveaugmented(data);
+
+  for (HighsInt k = 0; k < data.num_primal; k++) {
+    const HighsInt pos = data.position[k];
+    step.dv[k] = pos < 0 ? 0.0 : data.sol[pos];
+    step.ds_lo[k] = 0.0;
+    step.dz_lo[k] = 0.0;
+    step.ds_up[k] = 0.0;
+    step.dz_up[k] = 0.0;
+    if (haslower(data, k)) {
+      step.ds_lo[k] = step.dv[k] - data.r_lo[k];
+      step.dz_lo[k] =
+          (r_clo[k] - data.z_lo[k] * step.ds_lo[k]) / data.s_lo[k];
+    }
+    if (hasupper(data, k)) {
+      step.ds_up[k] = data.r_up[k] - step.dv[k];
+      step.dz_up[k] =
+          (r_cup[k] - data.z_up[k] * step.ds_up[k]) / data.s_up[k];
+    }
+  }
+  for (HighsInt row = 0; row < data.num_con; row++)
+    step.dy[row] = data.sol[data.num_free + row];
+}
+
+// largest step that keeps the slacks and bound duals nonnegative
+static double maxsteplength(const IpmData& data, const IpmStep& step) {
+  double alpha = std::numeric_limits<double>::infinity();
+  for (HighsInt k = 0; k < data.num_primal; k++) {
+    if (haslower(data, k)) {
+      if (step.ds_lo[k] < 0.0)
+        alpha = std::min(alpha, -data.s_lo[k] / step.ds_lo[k]);
+      if (step.dz_lo[k] < 0.0)
+        alpha = std::min(alpha, -data.z_lo[k] / step.dz_lo[k]);
+    }
+    if (hasupper(data, k)) {
+      if (step.ds_up[k] < 0.0)
+        alpha = std::min(alpha, -data.s_up[k] / step.ds_up[k]);
+      if (step.dz_up[k] < 0.0)
+        alpha = std::min(alpha, -data.z_up[k] / step.dz_up[k]);
+    }
+  }
+  return alpha;
+}
+
+static double complementarity(const IpmData& data, const IpmStep* step,
+                              double alpha) {
+  double sum = 0.0;
+  for (HighsInt k = 0; k < data.num_primal; k++) {
+    if (haslower(data, k)) {
+      double s = data.s_lo[k];
+      double z = data.z_lo[k];
+      if (step) {
+        s += alpha * step->ds_lo[k];
+        z += alpha * step->dz_lo[k];
+      }
+      sum += s * z;
+    }
+    if (hasupper(data, k)) {
+      double s = data.s_up[k];
+      double z = data.z_up[k];
+      if (step) {
+        s += alpha * step->ds_up[k];
+        z += alpha * step->dz_up[k];
+      }
+      sum += s * z;
+    }
+  }
+  return sum;
+}
+
+// bound of the given primal variable that is identified as active at the
+// interior point solution
+static BasisStatus activestatus(const IpmData& data, HighsInt k) {
+  if (data.position[k] < 0) {
+    const double dual =
+        k < data.num_var ? data.r_dual[k] : data.y[k - data.num_var];
+    return dual >= 0.0 ? BasisStatus::ActiveAtLower
+                       : BasisStatus::ActiveAtUpper;
+  }
+  const bool atlower = haslower(data, k) && data.s_lo[k] < data.z_lo[k];
+  const bool atupper = hasupper(data, k) && data.s_up[k] < data.z_up[k];
+  if (atlower && (!atupper || data.s_lo[k] <= data.s_up[k]))
+    return BasisStatus::ActiveAtLower;
+  if (atupper) return BasisStatus::ActiveAtUpper;
+  return BasisStatus::Inactive;
+}
+
+// index of the constraint of the active set method that corresponds to the
+// given primal variable
+static HighsInt constraintindex(const IpmData& data, HighsInt k) {
+  return k < data.num_var ? data.num_con + k : k - data.num_var;
+}
+
+static void extractsolution(Instance& instance, IpmData& data,
+                            QpSolution& solution) {
+  const HighsInt n = data.num_var;
+  const HighsInt m = data.num_con;
+  // the dual values of the columns are the reduced costs c + Q*x - A^T*y,
+  // which is also how the duals of fixed columns are obtained
+  computehessianproduct(instance, data.v.data(), data.qx);
+  computetransposeproduct(instance, data.y, data.aty);
+  for (HighsInt k = 0; k < n; k++)
+    if (data.position[k] < 0)
+      data.r_dual[k] = instance.c.value[k] + data.qx[k] - data.aty[k];
+
+  std::vector<double> activity;
+  computeactivity(instance, data.v.data(), activity);
+  for (HighsInt col = 0; col < n; col++) {
+    solution.primal.value[col] = data.v[col];
+    solution.dualvar.value[col] =
+        instance.c.value[col] + data.qx[col] - data.aty[col];
+    solution.status_var[col] = activestatus(data, col);
+  }
+  for (HighsInt row = 0; row < m; row++) {
+    solution.rowactivity.value[row] = activity[row];
+    solution.dualcon.value[row] = data.y[row];
+    solution.status_con[row] = activestatus(data, n + row);
+  }
+  solution.primal.resparsify();
+  solution.dualvar.resparsify();
+  solution.rowactivity.resparsify();
+  solution.dualcon.resparsify();
+}
+
+// completes the constraints that are identified as active at the interior
+// point solution to a basis of the active set method in the same way as an
+// alien simplex basis is completed, and starts the active set method from
+// there
+static bool crossover(Instance& instance, Settings& settings,
+                      Statistics& stats, IpmData& data,
+                      QpModelStatus& modelstatus, QpSolution& solution,
+                      HighsTimer& qp_timer) {
+  const HighsInt n = data.num_var;
+  const HighsInt m = data.num_con;
+  std::vector<BasisStatus> status(n + m, BasisStatus::Inactive);
+  std::vector<HighsInt> basic_index;
+  for (HighsInt k = 0; k < data.num_primal; k++) {
+    BasisStatus kstatus = activestatus(data, k);
+    if (kstatus == BasisStatus::Inactive) continue;
+    status[constraintindex(data, k)] = kstatus;
+    basic_index.push_back(constraintindex(data, k));
+  }
+
+  // the constraint normals are the columns of A^T, and the bounds of the
+  // columns correspond to its logicals
+  MatrixBase& Atran = instance.A.t();
+  std::vector<HighsInt> index = Atran.index;
+  std::vector<double> value = Atran.value;
+  if (index.empty()) {
+    index.resize(1);
+    value.resize(1);
+  }
+  const HighsInt num_basic = basic_index.size();
+  HFactor factor;
+  factor.setupGeneral(Atran.num_col, Atran.num_row, num_basic,
+                      Atran.start.data(), index.data(), value.data(),
+                      basic_index.data());
+  const HighsInt rank_deficiency = factor.build();
+  if (rank_deficiency < 0) return false;
+
+  QpHotstartInformation startinfo(n, m);
+  const HighsInt use_basic = std::min(n, num_basic);
+  for (HighsInt i = 0; i < use_basic; i++) {
+    const HighsInt con = basic_index[i];
+    if (status[con] == BasisStatus::Inactive) {
+      startinfo.inactive.push_back(con);
+    } else {
+      startinfo.active.push_back(con);
+      startinfo.status.push_back(status[con]);
+    }
+  }
+  const HighsInt num_missing = n - use_basic;
+  for (HighsInt k = 0; k < num_missing; k++)
+    startinfo.inactive.push_back(
+        m + factor.row_with_no_pivot[rank_deficiency + k]);
+  assert((HighsInt)(startinfo.active.size() + startinfo.inactive.size()) ==
+         n);
+
+  // move the active bounds of the columns onto their bounds
+  for (HighsInt col = 0; col < n; col++) {
+    double x = data.v[col];
+    if (data.position[col] >= 0) {
+      if (status[m + col] == BasisStatus::ActiveAtLower)
+        x = data.lower[col];
+      else if (status[m + col] == BasisStatus::ActiveAtUpper)
+        x = data.upper[col];
+    }
+    startinfo.primal.value[col] = x;
+  }
+  startinfo.primal.resparsify();
+  instance.A.mat_vec(startinfo.primal, startinfo.rowact);
+
+  QpModelStatus crossoverstatus = QpModelStatus::INDETERMINED;
+  QpSolution crossoversolution(instance);
+  solveqp_actual(instance, settings, startinfo, stats, crossoverstatus,
+                 crossoversolution, qp_timer);
+  if (crossoverstatus != QpModelStatus::OPTIMAL) return false;
+
+  modelstatus = crossoverstatus;
+  solution = crossoversolution;
+  return true;
+}
+
+QpAsmStatus solveqp_ipm(Instance& instance, Settings& settings,
+                        Statistics& stats, QpModelStatus& modelstatus,
+                        QpSolution& solution, HighsTimer& qp_timer) {
+  IpmData data;
+  setup(instance, data);
+  initialpoint(instance, data);
+
+  // norms of the bounds and costs to measure relative infeasibilities
+  double boundnorm = 0.0;
+  for (HighsInt k = 0; k < data.num_primal; k++) {
+    if (std::isfinite(data.lower[k]))
+      boundnorm = std::max(boundnorm, std::fabs(data.lower[k]));
+    if (std::isfinite(data.upper[k]))
+      boundnorm = std::max(boundnorm, std::fabs(data.upper[k]));
+  }
+  double costnorm = 0.0;
+  for (HighsInt col = 0; col < data.num_var; col++)
+    costnorm = std::max(costnorm, std::fabs(instance.c.value[col]));
+
+  IpmStep step(data.num_primal, data.num_con);
+  IpmStep corrector(data.num_primal, data.num_con);
+  std::vector<double> r_clo(data.num_primal);
+  std::vector<double> r_cup(data.num_primal);
+  // the largest of the relative infeasibilities and complementarity must
+  // decrease by a factor in a number of iterations
+  double bestmerit = std::numeric_limits<double>::infinity();
+  HighsInt numstalled = 0;
+
+  modelstatus = QpModelStatus::INDETERMINED;
+  while (true) {
+    computeresiduals(instance, data);
+
+    double primalinfeasibility = 0.0;
+    for (HighsInt row = 0; row < data.num_con; row++)
+      primalinfeasibility =
+          std::max(primalinfeasibility, std::fabs(data.r_primal[row]));
+    double dualinfeasibility = 0.0;
+    for (HighsInt k = 0; k < data.num_primal; k++) {
+      primalinfeasibility =
+          std::max(primalinfeasibility, std::fabs(data.r_lo[k]));
+      primalinfeasibility =
+          std::max(primalinfeasibility, std::fabs(data.r_up[k]));
+      dualinfeasibility =
+          std::max(dualinfeasibility, std::fabs(data.r_dual[k]));
+    }
+    const double compl_sum = complementarity(data, nullptr, 0.0);
+    double objective = instance.offset;
+    for (HighsInt col = 0; col < data.num_var; col++)
+      objective += (instance.c.value[col] + 0.5 * data.qx[col]) * data.v[col];
+
+    stats.ipm_time.push_back(qp_timer.readRunHighsClock());
+    stats.ipm_objval.push_back(objective);
+    stats.ipm_primal_infeasibility.push_back(primalinfeasibility);
+    stats.ipm_dual_infeasibility.push_back(dualinfeasibility);
+    stats.ipm_complementarity.push_back(compl_sum);
+    settings.ipmiterationevent.fire(stats);
+
+    const double primalmerit = primalinfeasibility / (1.0 + boundnorm);
+    const double dualmerit = dualinfeasibility / (1.0 + costnorm);
+    const double complmerit = compl_sum / (1.0 + std::fabs(objective));
+    if (primalmerit <= settings.ipm_feasibility_tolerance &&
+        dualmerit <= settings.ipm_feasibility_tolerance &&
+        complmerit <= settings.ipm_optimality_tolerance) {
+      modelstatus = QpModelStatus::OPTIMAL;
+      break;
+    }
+    const double merit = std::max(std::max(primalmerit, dualmerit), complmerit);
+    if (merit < 0.5 * bestmerit) {
+      bestmerit = merit;
+      numstalled = 0;
+    } else {
+      numstalled++;
+    }
+
+    if (stats.ipm_iterations >= settings.ipm_iterationlimit) {
+      modelstatus = QpModelStatus::ITERATIONLIMIT;
+      break;
+    }
+    if (qp_timer.readRunHighsClock() >= settings.timelimit) {
+      modelstatus = QpModelStatus::TIMELIMIT;
+      break;
+    }
+    // a diverging or stalling method indicates that the QP is infeasible or
+    // unbounded, or that it has numerical difficulties, which are left to
+    // the active set method
+    if (stats.ipm_iterations >= kMaxIterations ||
+        numstalled >= kMaxStalledIterations || !std::isfinite(merit) ||
+        std::fabs(objective) >= kDivergence || compl_sum >= kDivergence)
+      break;
+
+    if (!factorize(data)) break;
+
+    // predictor
+    for (HighsInt k = 0; k < data.num_primal; k++) {
+      r_clo[k] = -data.s_lo[k] * data.z_lo[k];
+      r_cup[k] = -data.s_up[k] * data.z_up[k];
+    }
+    computestep(data, r_clo, r_cup, step);
+    double alpha = std::min(1.0, maxsteplength(data, step));
+
+    // corrector with the centering parameter of Mehrotra
+    if (data.num_complementarity > 0) {
+      const double mu = compl_sum / data.num_complementarity;
+      const double mu_aff =
+          complementarity(data, &step, alpha) / data.num_complementarity;
+      const double sigma = std::pow(mu_aff / mu, 3);
+      for (HighsInt k = 0; k < data.num_primal; k++) {
+        r_clo[k] = sigma * mu - data.s_lo[k] * data.z_lo[k] -
+                   step.ds_lo[k] * step.dz_lo[k];
+        r_cup[k] = sigma * mu - data.s_up[k] * data.z_up[k] -
+                   step.ds_up[k] * step.dz_up[k];
+        if (!haslower(data, k)) r_clo[k] = 0.0;
+        if (!hasupper(data, k)) r_cup[k] = 0.0;
+      }
+      computestep(data, r_clo, r_cup, corrector);
+      std::swap(step, corrector);
+    }
+    alpha = std::min(1.0, kStepToBoundary * maxsteplength(data, step));
+
+    for (HighsInt k = 0; k < data.num_primal; k++) {
+      data.v[k] += alpha * step.dv[k];
+      data.s_lo[k] += alpha * step.ds_lo[k];
+      data.s_up[k] += alpha * step.ds_up[k];
+      data.z_lo[k] += alpha * step.dz_lo[k];
+      data.z_up[k] += alpha * step.dz_up[k];
+    }
+    for (HighsInt row = 0; row < data.num_con; row++)
+      data.y[row] += alpha * step.dy[row];
+    stats.ipm_iterations++;
+  }
+
+  if (modelstatus == QpModelStatus::INDETERMINED) return QpAsmStatus::OK;
+
+  extractsolution(instance, data, solution);
+  if (modelstatus == QpModelStatus::OPTIMAL && settings.ipm_crossover)
+    stats.ipm_crossover = crossover(instance, settings, stats, data,
+                                    modelstatus, solution, qp_timer);
+  return QpAsmStatus::OK;
+}
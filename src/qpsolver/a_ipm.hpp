@@ -0,0 +1,31 @@
+#ifndef __SRC_LIB_QPSOLVER_IPM_HPP__
+#define __SRC_LIB_QPSOLVER_IPM_HPP__
+
+#include "qpsolver/a_asm.hpp"
+#include "qpsolver/instance.hpp"
+#include "qpsolver/qpconst.hpp"
+#include "qpsolver/settings.hpp"
+#include "util/HighsTimer.h"
+
+// primal-dual interior point method for convex QP. The row activities are
+// treated as bounded variables, so that the constraints become A*x - r = 0,
+// and each iteration solves the quasidefinite augmented system
+//
+//   [ -(Q + D)  A^T ] [dx]
+//   [     A      0  ] [dy]
+//
+// with a Mehrotra predictor-corrector step, where D is the diagonal barrier
+// term of the bounds. Fixed variables and equality rows are not part of the
+// system. If the solver converges and settings.ipm_crossover is set, the
+// constraints identified as active are completed to a basis and the active
+// set method is started from the interior point solution to obtain a vertex
+// solution.
+//
+// If the method fails to converge for numerical reasons or because the QP is
+// infeasible or unbounded, the model status is left INDETERMINED so that the
+// caller can fall back to the active set method.
+QpAsmStatus solveqp_ipm(Instance& instance, Settings& settings,
+                        Statistics& stats, QpModelStatus& modelstatus,
+                        QpSolution& solution, HighsTimer& qp_timer);
+
+#endif
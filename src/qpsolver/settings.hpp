@@ -49,6 +49,13 @@ struct Settings {
   bool varscaling = true;
 
   bool perturbation = false;
+
+  // interior point method
+  double ipm_feasibility_tolerance = 1E-7; // relative primal and dual residuals at an optimal solution
+  double ipm_optimality_tolerance = 1E-8; // relative complementarity at an optimal solution
+  HighsInt ipm_iterationlimit = std::numeric_limits<HighsInt>::max();
+  bool ipm_crossover = true; // if true, the active set method is started from the interior point solution
+  Eventhandler<Statistics&> ipmiterationevent;
 };
 
 #endif
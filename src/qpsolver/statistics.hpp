@@ -18,6 +18,14 @@ struct Statistics {
   std::vector<HighsInt> num_primal_infeasibilities;
   std::vector<double> density_nullspace;
   std::vector<double> density_factor;
+
+  HighsInt ipm_iterations = 0;
+  bool ipm_crossover = false; // whether the interior point solution was refined into a vertex solution by the active set method
+  std::vector<double> ipm_time;
+  std::vector<double> ipm_objval;
+  std::vector<double> ipm_primal_infeasibility;
+  std::vector<double> ipm_dual_infeasibility;
+  std::vector<double> ipm_complementarity;
 };
 
 #endif
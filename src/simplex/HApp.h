@@ -40,9 +40,11 @@ inline HighsStatus returnFromSolveLpSimplex(HighsLpSolverObject& solver_object,
   HighsOptions& options = solver_object.options_;
   HEkk& ekk_instance = solver_object.ekk_instance_;
   HighsLp& incumbent_lp = solver_object.lp_;
-  // Copy the simplex iteration count to highs_info_ from ekk_instance
+  // Copy the simplex iteration and work counts to highs_info_ from
+  // ekk_instance
   solver_object.highs_info_.simplex_iteration_count =
       ekk_instance.iteration_count_;
+  solver_object.highs_info_.work_count = ekk_instance.work_count_;
   // Ensure that the incumbent LP is neither moved, nor scaled
   assert(!incumbent_lp.is_moved_);
   assert(!incumbent_lp.is_scaled_);
@@ -100,9 +102,10 @@ inline HighsStatus solveLpSimplex(HighsLpSolverObject& solver_object) {
     return_status = HighsStatus::kError;
   }
 
-  // Copy the simplex iteration count from highs_info_ to ekk_instance, just for
-  // convenience
+  // Copy the simplex iteration and work counts from highs_info_ to
+  // ekk_instance, just for convenience
   ekk_instance.iteration_count_ = highs_info.simplex_iteration_count;
+  ekk_instance.work_count_ = highs_info.work_count;
 
   // Reset the model status and HighsInfo values in case of premature
   // return
@@ -229,8 +232,9 @@ inline HighsStatus solveLpSimplex(HighsLpSolverObject& solver_object) {
       scaled_model_status = ekk_instance.model_status_;
       highs_info.objective_function_value = ekk_info.primal_objective_value;
       highs_info.simplex_iteration_count = ekk_instance.iteration_count_;
-      solution = ekk_instance.getSolution();
-      basis = ekk_instance.getHighsBasis(ekk_lp);
+      highs_info.work_count = ekk_instance.work_count_;
+      ekk_instance.getSolution(solution);
+      ekk_instance.getHighsBasis(ekk_lp, basis);
       assert(basis.valid);
       highs_info.basis_validity = kBasisValidityValid;
       incumbent_lp.moveBackLpAndUnapplyScaling(ekk_lp);
@@ -377,8 +381,9 @@ inline HighsStatus solveLpSimplex(HighsLpSolverObject& solver_object) {
     scaled_model_status = ekk_instance.model_status_;
     highs_info.objective_function_value = ekk_info.primal_objective_value;
     highs_info.simplex_iteration_count = ekk_instance.iteration_count_;
-    solution = ekk_instance.getSolution();
-    basis = ekk_instance.getHighsBasis(ekk_lp);
+    highs_info.work_count = ekk_instance.work_count_;
+    ekk_instance.getSolution(solution);
+    ekk_instance.getHighsBasis(ekk_lp, basis);
     assert(basis.valid);
     highs_info.basis_validity = kBasisValidityValid;
   }
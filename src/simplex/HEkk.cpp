@@ -1380,6 +1380,11 @@ void HEkk::unscaleSimplex(const HighsLp& incumbent_lp) {
 
 HighsSolution HEkk::getSolution() {
   HighsSolution solution;
+  getSolution(solution);
+  return solution;
+}
+
+void HEkk::getSolution(HighsSolution& solution) {
   // Scatter the basic primal values
   for (HighsInt iRow = 0; iRow < lp_.num_row_; iRow++)
     info_.workValue_[basis_.basicIndex_[iRow]] = info_.baseValue_[iRow];
@@ -1405,13 +1410,17 @@ HighsSolution HEkk::getSolution() {
   }
   solution.value_valid = true;
   solution.dual_valid = true;
-  return solution;
 }
 
 HighsBasis HEkk::getHighsBasis(HighsLp& use_lp) const {
+  HighsBasis highs_basis;
+  getHighsBasis(use_lp, highs_basis);
+  return highs_basis;
+}
+
+void HEkk::getHighsBasis(HighsLp& use_lp, HighsBasis& highs_basis) const {
   HighsInt num_col = use_lp.num_col_;
   HighsInt num_row = use_lp.num_row_;
-  HighsBasis highs_basis;
   highs_basis.col_status.resize(num_col);
   highs_basis.row_status.resize(num_row);
   assert(status_.has_basis);
@@ -1467,7 +1476,6 @@ HighsBasis HEkk::getHighsBasis(HighsLp& use_lp) const {
       (HighsInt)(build_synthetic_tick_ + total_synthetic_tick_);
   highs_basis.debug_update_count = info_.update_count;
   highs_basis.debug_origin_name = basis_.debug_origin_name;
-  return highs_basis;
 }
 
 HighsStatus HEkk::initialiseSimplexLpBasisAndFactor(
@@ -2038,6 +2046,18 @@ bool HEkk::rebuildRefactor(HighsInt rebuild_reason) {
   return refactor;
 }
 
+void HEkk::countIterationWork(const HVector* column, const HVector* row_ep,
+                              const HVector* row_ap) {
+  // An iteration is counted as the nonzeros of the vectors that it has
+  // computed, with a vector whose nonzeros are not known counted as dense
+  auto vectorWork = [](const HVector* vector) -> int64_t {
+    if (vector == nullptr) return 0;
+    return vector->count >= 0 ? vector->count : vector->size;
+  };
+  work_count_ +=
+      1 + vectorWork(column) + vectorWork(row_ep) + vectorWork(row_ap);
+}
+
 HighsInt HEkk::computeFactor() {
   assert(status_.has_nla);
   if (status_.has_fresh_invert) return 0;
@@ -2049,6 +2069,7 @@ HighsInt HEkk::computeFactor() {
   analysis_.simplexTimerStart(InvertClock);
   const HighsInt rank_deficiency = simplex_nla_.invert();
   analysis_.simplexTimerStop(InvertClock);
+  work_count_ += simplex_nla_.factor_.invert_num_el;
   //
   // Set up hot start information
   hot_start_.refactor_info = simplex_nla_.factor_.refactor_info_;
@@ -3461,6 +3482,7 @@ bool HEkk::bailout() {
     // reasons
     assert(model_status_ == HighsModelStatus::kTimeLimit ||
            model_status_ == HighsModelStatus::kIterationLimit ||
+           model_status_ == HighsModelStatus::kWorkLimit ||
            model_status_ == HighsModelStatus::kObjectiveBound ||
            model_status_ == HighsModelStatus::kObjectiveTarget);
   } else if (timer_->readRunHighsClock() > options_->time_limit) {
@@ -3469,6 +3491,9 @@ bool HEkk::bailout() {
   } else if (iteration_count_ >= options_->simplex_iteration_limit) {
     solve_bailout_ = true;
     model_status_ = HighsModelStatus::kIterationLimit;
+  } else if (work_count_ >= options_->work_limit) {
+    solve_bailout_ = true;
+    model_status_ = HighsModelStatus::kWorkLimit;
   } else if (callback_->user_callback &&
              callback_->active[kCallbackSimplexInterrupt]) {
     callback_->clearHighsCallbackDataOut();
@@ -3507,7 +3532,8 @@ HighsStatus HEkk::returnFromSolve(const HighsStatus return_status) {
            model_status_ == HighsModelStatus::kIterationLimit ||
            model_status_ == HighsModelStatus::kObjectiveBound ||
            model_status_ == HighsModelStatus::kObjectiveTarget ||
-           model_status_ == HighsModelStatus::kInterrupt);
+           model_status_ == HighsModelStatus::kInterrupt ||
+           model_status_ == HighsModelStatus::kWorkLimit);
   }
   // Check that returnFromSolve has not already been called: it should
   // be called exactly once per solve
@@ -3594,10 +3620,11 @@ HighsStatus HEkk::returnFromSolve(const HighsStatus return_status) {
     case HighsModelStatus::kTimeLimit:
     case HighsModelStatus::kIterationLimit:
     case HighsModelStatus::kInterrupt:
+    case HighsModelStatus::kWorkLimit:
     case HighsModelStatus::kUnknown: {
       // Simplex has failed to conclude a model property. Either it
       // has bailed out due to reaching the objecive bound, target,
-      // time, iteration limit or user interrupt, or it has not been
+      // time, iteration or work limit or user interrupt, or it has not been
       // set (cycling is the only reason). Could happen anywhere.
       //
       // Reset the simplex bounds and recompute primals
@@ -98,6 +98,9 @@ class HEkk {
 
   HighsSolution getSolution();
   HighsBasis getHighsBasis(HighsLp& use_lp) const;
+  // Versions that reuse the storage of an existing solution and basis
+  void getSolution(HighsSolution& solution);
+  void getHighsBasis(HighsLp& use_lp, HighsBasis& highs_basis) const;
 
   const SimplexBasis& getSimplexBasis() { return basis_; }
 
@@ -159,6 +162,8 @@ class HEkk {
   double cost_perturbation_base_;
   double cost_perturbation_max_abs_cost_;
   HighsInt iteration_count_ = 0;
+  // Deterministic work of the simplex iterations and INVERTs
+  int64_t work_count_ = 0;
   HighsInt dual_simplex_cleanup_level_ = 0;
   HighsInt dual_simplex_phase1_cleanup_level_ = 0;
 
@@ -227,6 +232,8 @@ class HEkk {
   void computeDualObjectiveValue(const HighsInt phase = 2);
   bool rebuildRefactor(HighsInt rebuild_reason);
   HighsInt computeFactor();
+  void countIterationWork(const HVector* column, const HVector* row_ep,
+                          const HVector* row_ap);
   void computeDualSteepestEdgeWeights(const bool initial = false);
   double computeDualSteepestEdgeWeight(const HighsInt iRow, HVector& row_ep);
   void updateDualSteepestEdgeWeights(const HighsInt row_out,
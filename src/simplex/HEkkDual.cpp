@@ -2226,6 +2226,7 @@ void HEkkDual::updatePivots() {
   //  update_pivots");
   //
   ekk_instance_.iteration_count_++;
+  ekk_instance_.countIterationWork(&col_aq, &row_ep, &row_ap);
   //
   // Update the invertible representation of the basis matrix
   ekk_instance_.updateFactor(&col_aq, &row_ep, &row_out, &rebuild_reason);
@@ -2752,6 +2753,7 @@ bool HEkkDual::bailoutOnDualObjective() {
     // reasons
     assert(ekk_instance_.model_status_ == HighsModelStatus::kTimeLimit ||
            ekk_instance_.model_status_ == HighsModelStatus::kIterationLimit ||
+           ekk_instance_.model_status_ == HighsModelStatus::kWorkLimit ||
            ekk_instance_.model_status_ == HighsModelStatus::kObjectiveBound);
   } else if (ekk_instance_.lp_.sense_ == ObjSense::kMinimize &&
              solve_phase == kSolvePhase2) {
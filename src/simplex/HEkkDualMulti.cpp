@@ -456,6 +456,7 @@ void HEkkDual::minorUpdatePivots() {
   // distribution is not updated
   numericalTrouble = -1;
   ekk_instance_.iteration_count_++;
+  ekk_instance_.countIterationWork(nullptr, finish->row_ep, nullptr);
 }
 
 void HEkkDual::minorUpdateRows() {
@@ -1527,6 +1527,7 @@ void HEkkPrimal::update() {
 
   // Update the iteration count
   ekk_instance_.iteration_count_++;
+  ekk_instance_.countIterationWork(&col_aq, &row_ep, &row_ap);
 
   // Reset the devex when there are too many errors
   if (edge_weight_mode == EdgeWeightMode::kDevex &&
@@ -45,8 +45,16 @@ class HighsDataStack {
   template <typename T,
             typename std::enable_if<IS_TRIVIALLY_COPYABLE(T), int>::type = 0>
   void pop(T& r) {
-    position -= sizeof(T);
-    std::memcpy(&r, data.data() + position, sizeof(T));
+    pop(position, r);
+  }
+
+  // variant of pop that reads from the given position and leaves the stack
+  // position untouched, so that independent entries can be read concurrently
+  template <typename T,
+            typename std::enable_if<IS_TRIVIALLY_COPYABLE(T), int>::type = 0>
+  void pop(HighsInt& position_, T& r) const {
+    position_ -= sizeof(T);
+    std::memcpy(&r, data.data() + position_, sizeof(T));
   }
 
   template <typename T>
@@ -64,20 +72,34 @@ class HighsDataStack {
 
   template <typename T>
   void pop(std::vector<T>& r) {
+    pop(position, r);
+  }
+
+  template <typename T>
+  void pop(HighsInt& position_, std::vector<T>& r) const {
     // pop the vector size
-    position -= sizeof(std::size_t);
+    position_ -= sizeof(std::size_t);
     std::size_t numData;
-    std::memcpy(&numData, &data[position], sizeof(std::size_t));
+    std::memcpy(&numData, &data[position_], sizeof(std::size_t));
     // pop the data
     if (numData == 0) {
       r.clear();
     } else {
       r.resize(numData);
-      position -= numData * sizeof(T);
-      std::memcpy(r.data(), data.data() + position, numData * sizeof(T));
+      position_ -= numData * sizeof(T);
+      std::memcpy(r.data(), data.data() + position_, numData * sizeof(T));
     }
   }
 
+  // move the given position over a vector without copying its data
+  template <typename T>
+  void skipVector(HighsInt& position_) const {
+    position_ -= sizeof(std::size_t);
+    std::size_t numData;
+    std::memcpy(&numData, &data[position_], sizeof(std::size_t));
+    position_ -= numData * sizeof(T);
+  }
+
   void setPosition(HighsInt position_) { this->position = position_; }
 
   HighsInt getCurrentDataSize() const { return data.size(); }
@@ -1257,6 +1257,26 @@ class HighsHashTable {
   HighsHashTable(HighsHashTable<K, V>&&) = default;
   HighsHashTable<K, V>& operator=(HighsHashTable<K, V>&&) = default;
 
+  HighsHashTable(const HighsHashTable<K, V>& other)
+      : tableSizeMask(other.tableSizeMask),
+        numHashShift(other.numHashShift),
+        numElements(other.numElements) {
+    u64 capacity = tableSizeMask + 1;
+    metadata = decltype(metadata)(new u8[capacity]);
+    entries =
+        decltype(entries)((Entry*)::operator new(sizeof(Entry) * capacity));
+    std::memcpy(metadata.get(), other.metadata.get(), capacity);
+    for (u64 i = 0; i < capacity; ++i) {
+      if (occupied(metadata[i]))
+        new (&entries.get()[i]) Entry(other.entries.get()[i]);
+    }
+  }
+
+  HighsHashTable<K, V>& operator=(const HighsHashTable<K, V>& other) {
+    if (this != &other) *this = HighsHashTable<K, V>(other);
+    return *this;
+  }
+
   ~HighsHashTable() {
     if (!std::is_trivially_destructible<Entry>::value && metadata) {
       u64 capacity = tableSizeMask + 1;